@@ -0,0 +1,459 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file bench.c
+ * @brief Medición del costo de las funciones de la biblioteca GPIO.
+ *
+ * Este programa ejecuta cada función de acceso a los GPIO una cantidad fija de veces y reporta el
+ * costo promedio de cada llamada. En la computadora se compila sobre la HAL simulada y se mide el
+ * tiempo real transcurrido en nanosegundos; en el microcontrolador se utiliza el contador de ciclos
+ * DWT del núcleo Cortex-M. Cada medición se informa en nanosegundos y en ciclos por llamada,
+ * convirtiendo la unidad medida con BENCH_CPU_FREQUENCY; en la computadora los ciclos solo se
+ * informan si se define esa frecuencia, ya que la del procesador no se conoce. Los valores incluyen
+ * el costo del lazo de repetición, que se informa aparte como referencia.
+ *
+ * Se compila y ejecuta con `make bench`.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#if !defined(__arm__)
+#define _POSIX_C_SOURCE 199309L /**< Habilita clock_gettime() al compilar con -std=c11. */
+#endif
+#include "gpio.h"
+#include "gpio_pin.h"
+#include "hal.h"
+#ifdef USE_FAST_GPIO
+#include "gpio_fast.h"
+#endif
+#include <stdio.h>
+#if !defined(__arm__)
+#include <time.h>
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 100000 /**< Cantidad de llamadas de cada medición. */
+#endif
+
+#define BENCH_PORT    2 /**< Puerto utilizado en las mediciones. */
+#define BENCH_BIT     5 /**< Bit utilizado en las mediciones. */
+#define BENCH_PIN_BIT 8 /**< Bit del descriptor, sin objeto y fuera de los pines medidos. */
+
+#define NANOSECONDS 1000000000.0 /**< Cantidad de nanosegundos en un segundo. */
+
+#if defined(__arm__)
+#define DWT_CONTROL      (*(volatile uint32_t *)0xE0001000) /**< Control del DWT. */
+#define DWT_CYCLES       (*(volatile uint32_t *)0xE0001004) /**< Contador de ciclos del DWT. */
+#define DEBUG_EXCEPTIONS (*(volatile uint32_t *)0xE000EDFC) /**< Registro DEMCR del núcleo. */
+#define DWT_CYCCNTENA    (1u << 0)                          /**< Habilita el contador. */
+#define DEMCR_TRCENA     (1u << 24)                         /**< Habilita el bloque DWT. */
+#endif
+
+#if defined(__arm__) || defined(BENCH_CPU_FREQUENCY)
+#define BENCH_CYCLES /**< Se conoce la frecuencia del procesador y se pueden informar los ciclos. */
+#endif
+
+#if defined(__arm__) && !defined(BENCH_CPU_FREQUENCY)
+/**
+ * Frecuencia del procesador en Hz para convertir entre ciclos y nanosegundos. En el
+ * microcontrolador es por omisión la del contador DWT; en la computadora no tiene valor por
+ * omisión y se debe definir con la frecuencia del procesador para informar los ciclos.
+ */
+#define BENCH_CPU_FREQUENCY hal_timestamp_frequency()
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Función que ejecuta una cantidad de llamadas a la operación medida.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+typedef void (*bench_body_t)(uint32_t iterations);
+
+/**
+ * @brief Descripción de una medición.
+ */
+typedef struct bench_case_s {
+    const char * name; /**< Nombre de la operación medida. */
+    bench_body_t body; /**< Función que repite la operación. */
+} bench_case_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Prepara el reloj de las mediciones.
+ */
+static void clockInit(void);
+
+/**
+ * @brief Lee el reloj de las mediciones.
+ *
+ * @return uint32_t Nanosegundos en la computadora o ciclos del núcleo en el microcontrolador.
+ */
+static uint32_t clockRead(void);
+
+/**
+ * @brief Ejecuta una medición y reporta el costo promedio de cada llamada.
+ *
+ * @param bench Medición que se ejecuta.
+ */
+static void benchRun(const bench_case_t * bench);
+
+/**
+ * @brief Mide el costo del lazo de repetición sin ninguna operación.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchLoop(uint32_t iterations);
+
+/**
+ * @brief Mide la creación y destrucción de un objeto GPIO.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchCreate(uint32_t iterations);
+
+/**
+ * @brief Mide gpioSetOutput() alternando la dirección del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchSetOutput(uint32_t iterations);
+
+/**
+ * @brief Mide gpioSetState() alternando el estado del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchSetState(uint32_t iterations);
+
+/**
+ * @brief Mide gpioGetState().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchGetState(uint32_t iterations);
+
+/**
+ * @brief Mide gpioToggle().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchToggle(uint32_t iterations);
+
+/**
+ * @brief Mide gpioPortWrite() sobre ocho pines del puerto.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPortWrite(uint32_t iterations);
+
+/**
+ * @brief Mide gpioPortToggle() sobre ocho pines del puerto.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPortToggle(uint32_t iterations);
+
+/**
+ * @brief Mide gpioPinSetState() con un descriptor constante.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPinSetState(uint32_t iterations);
+
+/**
+ * @brief Mide gpioPinGetState() con un descriptor constante.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPinGetState(uint32_t iterations);
+
+#ifdef USE_FAST_GPIO
+/**
+ * @brief Mide gpioFastSetState() alternando el estado del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchFastSetState(uint32_t iterations);
+
+/**
+ * @brief Mide gpioFastGetState().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchFastGetState(uint32_t iterations);
+#endif
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Destino de los valores leídos, para que el compilador no elimine las lecturas. */
+static volatile bool sink;
+
+/** GPIO sobre el que se realizan las mediciones. */
+static gpio_t pin;
+
+/** Descriptor constante de un pin que no pertenece a ningún objeto GPIO. */
+static const gpio_pin_t PIN = GPIO_PIN(BENCH_PORT, BENCH_PIN_BIT);
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Prepara el reloj de las mediciones.
+ *
+ * En el microcontrolador habilita el contador de ciclos DWT; en la computadora no es necesario
+ * preparar el reloj.
+ */
+static void clockInit(void) {
+#if defined(__arm__)
+    DEBUG_EXCEPTIONS |= DEMCR_TRCENA;
+    DWT_CYCLES = 0;
+    DWT_CONTROL |= DWT_CYCCNTENA;
+#endif
+}
+
+/**
+ * @brief Lee el reloj de las mediciones.
+ *
+ * @return uint32_t Nanosegundos en la computadora o ciclos del núcleo en el microcontrolador.
+ */
+static uint32_t clockRead(void) {
+#if defined(__arm__)
+    return DWT_CYCLES;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000000ULL + now.tv_nsec);
+#endif
+}
+
+/**
+ * @brief Ejecuta una medición y reporta el costo promedio de cada llamada.
+ *
+ * El valor medido se informa en nanosegundos y, si se conoce la frecuencia del procesador, en
+ * ciclos, convirtiendo uno en otro con BENCH_CPU_FREQUENCY.
+ *
+ * @param bench Medición que se ejecuta.
+ */
+static void benchRun(const bench_case_t * bench) {
+    uint32_t start = clockRead();
+    bench->body(BENCH_ITERATIONS);
+    double elapsed = (double)(uint32_t)(clockRead() - start) / BENCH_ITERATIONS;
+
+#if defined(__arm__)
+    double cycles = elapsed;
+    double nanoseconds = elapsed * NANOSECONDS / BENCH_CPU_FREQUENCY;
+#else
+    double nanoseconds = elapsed;
+#ifdef BENCH_CYCLES
+    double cycles = elapsed * BENCH_CPU_FREQUENCY / NANOSECONDS;
+#endif
+#endif
+#ifdef BENCH_CYCLES
+    printf("%-24s %10.2f ns/op %10.2f ciclos/op\n", bench->name, nanoseconds, cycles);
+#else
+    printf("%-24s %10.2f ns/op\n", bench->name, nanoseconds);
+#endif
+}
+
+/**
+ * @brief Mide el costo del lazo de repetición sin ninguna operación.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchLoop(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        __asm__ volatile("" ::: "memory");
+    }
+}
+
+/**
+ * @brief Mide la creación y destrucción de un objeto GPIO.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchCreate(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioDestroy(gpioCreate(BENCH_PORT, BENCH_BIT + 1));
+    }
+}
+
+/**
+ * @brief Mide gpioSetOutput() alternando la dirección del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchSetOutput(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioSetOutput(pin, index & 1);
+    }
+    gpioSetOutput(pin, true);
+}
+
+/**
+ * @brief Mide gpioSetState() alternando el estado del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchSetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioSetState(pin, index & 1);
+    }
+}
+
+/**
+ * @brief Mide gpioGetState().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchGetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        sink = gpioGetState(pin);
+    }
+}
+
+/**
+ * @brief Mide gpioToggle().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchToggle(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioToggle(pin);
+    }
+}
+
+/**
+ * @brief Mide gpioPortWrite() sobre ocho pines del puerto.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPortWrite(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioPortWrite(BENCH_PORT, 0xFF, index);
+    }
+}
+
+/**
+ * @brief Mide gpioPortToggle() sobre ocho pines del puerto.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPortToggle(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioPortToggle(BENCH_PORT, 0xFF);
+    }
+}
+
+/**
+ * @brief Mide gpioPinSetState() con un descriptor constante.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPinSetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioPinSetState(PIN, index & 1);
+    }
+}
+
+/**
+ * @brief Mide gpioPinGetState() con un descriptor constante.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchPinGetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        sink = gpioPinGetState(PIN);
+    }
+}
+
+#ifdef USE_FAST_GPIO
+/**
+ * @brief Mide gpioFastSetState() alternando el estado del pin.
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchFastSetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        gpioFastSetState(pin, index & 1);
+    }
+}
+
+/**
+ * @brief Mide gpioFastGetState().
+ *
+ * @param iterations Cantidad de llamadas.
+ */
+static void benchFastGetState(uint32_t iterations) {
+    for (uint32_t index = 0; index < iterations; index++) {
+        sink = gpioFastGetState(pin);
+    }
+}
+#endif
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Función principal del programa de medición.
+ *
+ * @return int Retorna 0 si se pudieron ejecutar todas las mediciones.
+ */
+int main(void) {
+    static const bench_case_t benches[] = {
+        {"lazo vacio", benchLoop},
+        {"gpioCreate+gpioDestroy", benchCreate},
+        {"gpioSetOutput", benchSetOutput},
+        {"gpioSetState", benchSetState},
+        {"gpioGetState", benchGetState},
+        {"gpioToggle", benchToggle},
+        {"gpioPortWrite", benchPortWrite},
+        {"gpioPortToggle", benchPortToggle},
+        {"gpioPinSetState", benchPinSetState},
+        {"gpioPinGetState", benchPinGetState},
+#ifdef USE_FAST_GPIO
+        {"gpioFastSetState", benchFastSetState},
+        {"gpioFastGetState", benchFastGetState},
+#endif
+    };
+
+    pin = gpioCreate(BENCH_PORT, BENCH_BIT);
+    if (pin == NULL) {
+        return 1;
+    }
+    gpioSetOutput(pin, true);
+
+    clockInit();
+    for (size_t index = 0; index < sizeof(benches) / sizeof(benches[0]); index++) {
+        benchRun(&benches[index]);
+    }
+
+    gpioDestroy(pin);
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
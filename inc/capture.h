@@ -0,0 +1,171 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+/**
+ * @file capture.h
+ * @brief Captura de las entradas de un puerto GPIO al estilo de un analizador lógico.
+ *
+ * Este archivo define un capturador que muestrea un puerto completo a frecuencia fija desde la
+ * interrupción de un temporizador y almacena las muestras en un área de memoria circular provista
+ * por la aplicación. Las muestras se guardan codificadas por longitud de corrida: cada entrada
+ * guarda un valor y la cantidad de muestras consecutivas en que se repitió, por lo que las señales
+ * que cambian poco ocupan muy poca memoria.
+ *
+ * La captura puede detenerse automáticamente una cantidad fija de muestras después de una
+ * condición de disparo sobre un conjunto de pines, conservando en el área circular la historia
+ * previa al disparo.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+/* No se definen macros en este archivo */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef capture_t
+ * @brief Tipo de dato para representar un capturador.
+ */
+typedef struct capture_s * capture_t;
+
+/**
+ * @brief Condiciones de disparo de una captura.
+ */
+typedef enum capture_trigger_e {
+    CAPTURE_TRIGGER_NONE = 0,   /**< La captura continúa hasta que se detiene explícitamente. */
+    CAPTURE_TRIGGER_LEVEL = 1,  /**< Dispara cuando los pines de la máscara toman un valor. */
+    CAPTURE_TRIGGER_CHANGE = 2, /**< Dispara cuando cambia alguno de los pines de la máscara. */
+} capture_trigger_t;
+
+/**
+ * @brief Corrida de muestras iguales.
+ */
+typedef struct capture_run_s {
+    uint32_t value;  /**< Estado de los pines capturados. */
+    uint32_t length; /**< Cantidad de muestras consecutivas con ese estado. */
+} capture_run_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un capturador para un conjunto de pines de un puerto.
+ *
+ * @param timer Temporizador de hardware que marca el instante de cada muestra.
+ * @param port Puerto que se desea capturar.
+ * @param mask Máscara con los pines capturados, el resto se guarda en cero.
+ * @param runs Área de memoria circular donde se guardan las corridas.
+ * @param size Cantidad de corridas que caben en el área de memoria.
+ *
+ * @return El capturador creado o NULL si el temporizador o el puerto no existen, si falta el área
+ * de memoria o si no hay capturadores disponibles.
+ */
+capture_t captureCreate(uint8_t timer, uint8_t port, uint32_t mask, capture_run_t * runs,
+                        size_t size);
+
+/**
+ * @brief Configura la condición de disparo de la captura.
+ *
+ * @param capture Capturador que se desea configurar.
+ * @param trigger Condición de disparo.
+ * @param mask Máscara con los pines que intervienen en la condición.
+ * @param value Valor de los pines para el disparo por nivel.
+ * @param post Cantidad de muestras que se capturan después del disparo.
+ */
+void captureSetTrigger(capture_t capture, capture_trigger_t trigger, uint32_t mask, uint32_t value,
+                       uint32_t post);
+
+/**
+ * @brief Inicia la captura, descartando las muestras anteriores.
+ *
+ * @param capture Capturador que se desea iniciar.
+ * @param rate Cantidad de muestras por segundo.
+ *
+ * @return true si la captura se inició, false si `rate` es cero.
+ */
+bool captureStart(capture_t capture, uint32_t rate);
+
+/**
+ * @brief Detiene la captura.
+ *
+ * @param capture Capturador que se desea detener.
+ */
+void captureStop(capture_t capture);
+
+/**
+ * @brief Toma una muestra del puerto.
+ *
+ * La invoca la interrupción del temporizador, pero también puede llamarse directamente para
+ * muestrear a un ritmo marcado por la aplicación.
+ *
+ * @param capture Capturador que debe tomar la muestra.
+ *
+ * @return true si la captura continúa, false si terminó.
+ */
+bool captureSample(capture_t capture);
+
+/**
+ * @brief Indica si la captura está en curso.
+ *
+ * @param capture Capturador consultado.
+ *
+ * @return true si la captura está en curso, false si terminó o fue detenida.
+ */
+bool captureRunning(capture_t capture);
+
+/**
+ * @brief Copia las corridas capturadas, de la más antigua a la más reciente.
+ *
+ * @param capture Capturador consultado.
+ * @param runs Arreglo donde se copian las corridas.
+ * @param max Cantidad máxima de corridas que se pueden copiar en el arreglo.
+ * @param trigger Si no es NULL, recibe la posición en `runs` de la corrida que comienza con la
+ * muestra de disparo, o `max` si no hubo disparo o la corrida no se copió.
+ *
+ * @return La cantidad de corridas copiadas.
+ */
+size_t captureRead(capture_t capture, capture_run_t * runs, size_t max, size_t * trigger);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAPTURE_H */
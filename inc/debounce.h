@@ -0,0 +1,156 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+/**
+ * @file debounce.h
+ * @brief Filtro antirrebote que procesa en paralelo todos los pines de un puerto.
+ *
+ * Este archivo define un filtro que muestrea un puerto completo en cada llamada y mantiene un
+ * contador por pin almacenado en forma vertical: cada bit del contador ocupa una palabra distinta,
+ * de manera que los 32 contadores del puerto se actualizan con unas pocas operaciones lógicas. Un
+ * pin cambia de estado cuando su muestra difiere del estado estable durante la cantidad de
+ * muestras consecutivas configurada para ese pin.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef DEBOUNCE_COUNTER_BITS
+#define DEBOUNCE_COUNTER_BITS 4 /**< Cantidad de bits de los contadores de cada pin. */
+#endif
+
+#define DEBOUNCE_MAX_COUNT ((1 << DEBOUNCE_COUNTER_BITS) - 1) /**< Máximo valor de un contador. */
+
+#define DEBOUNCE_NO_PORT 0xFF /**< Filtro sin puerto, solo recibe muestras con debounceFilter(). */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef debounce_t
+ * @brief Tipo de dato para representar un filtro antirrebote.
+ */
+typedef struct debounce_s * debounce_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un filtro antirrebote para un conjunto de pines de un puerto.
+ *
+ * El estado estable inicial se toma de una lectura del puerto en el momento de la creación, con
+ * gpioPortRead(), por lo que también se pueden filtrar puertos virtuales. Un filtro creado con
+ * DEBOUNCE_NO_PORT no lee ningún puerto, arranca con todas las entradas en bajo y se alimenta con
+ * debounceFilter().
+ *
+ * @param port Puerto que se desea filtrar o DEBOUNCE_NO_PORT.
+ * @param mask Máscara con los pines del puerto que se desean filtrar.
+ * @param count Cantidad de muestras consecutivas necesarias para aceptar un cambio, entre 1 y
+ * DEBOUNCE_MAX_COUNT.
+ *
+ * @return El filtro creado o NULL si el puerto no existe o no hay filtros disponibles.
+ */
+debounce_t debounceCreate(uint8_t port, uint32_t mask, uint8_t count);
+
+/**
+ * @brief Cambia la cantidad de muestras necesarias para aceptar un cambio en algunos pines.
+ *
+ * @param debounce Filtro que se desea configurar.
+ * @param mask Máscara con los pines que se desean configurar.
+ * @param count Cantidad de muestras consecutivas, entre 1 y DEBOUNCE_MAX_COUNT.
+ */
+void debounceSetCount(debounce_t debounce, uint32_t mask, uint8_t count);
+
+/**
+ * @brief Muestrea el puerto y actualiza el filtro.
+ *
+ * Esta función realiza una única lectura del puerto y debe invocarse a intervalos regulares, por
+ * ejemplo desde una interrupción periódica. En un filtro sin puerto no tiene efecto.
+ *
+ * @param debounce Filtro que se desea actualizar.
+ *
+ * @return Máscara con los pines cuyo estado estable cambió en esta muestra.
+ */
+uint32_t debounceTick(debounce_t debounce);
+
+/**
+ * @brief Actualiza el filtro con una muestra provista por la aplicación.
+ *
+ * Permite utilizar el filtro con datos que no provienen directamente de un puerto, por ejemplo el
+ * estado de las teclas de un teclado matricial.
+ *
+ * @param debounce Filtro que se desea actualizar.
+ * @param sample Muestra con un bit por cada entrada filtrada.
+ *
+ * @return Máscara con las entradas cuyo estado estable cambió en esta muestra.
+ */
+uint32_t debounceFilter(debounce_t debounce, uint32_t sample);
+
+/**
+ * @brief Obtiene el estado estable de las entradas filtradas.
+ *
+ * @param debounce Filtro consultado.
+ *
+ * @return El estado estable, un bit por cada entrada; los pines fuera de la máscara valen cero.
+ */
+uint32_t debounceGetState(debounce_t debounce);
+
+/**
+ * @brief Fija el estado estable de las entradas filtradas.
+ *
+ * Se utiliza cuando las muestras no provienen del puerto indicado al crear el filtro y el estado
+ * inicial leído en ese momento no es válido. Los contadores de todas las entradas se reinician.
+ *
+ * @param debounce Filtro que se desea modificar.
+ * @param state Estado estable, un bit por cada entrada.
+ */
+void debounceSetState(debounce_t debounce, uint32_t state);
+
+/**
+ * @brief Obtiene la cantidad de filtros que todavía pueden crearse.
+ *
+ * Permite verificar los recursos antes de crear varios filtros, ya que los filtros no se destruyen.
+ *
+ * @return La cantidad de filtros disponibles.
+ */
+uint8_t debounceAvailable(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBOUNCE_H */
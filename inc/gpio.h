@@ -36,6 +36,7 @@ SPDX-License-Identifier: MIT
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /* === Cabecera para C++ ====================================================================== */
 
@@ -58,25 +59,127 @@ extern "C" {
  */
 typedef struct gpio_s * gpio_t;
 
+/**
+ * @typedef gpio_port_t
+ * @brief Tipo de dato para identificar un puerto GPIO completo.
+ *
+ * Las funciones que reciben un gpio_port_t operan sobre varios pines del mismo puerto a la vez,
+ * seleccionados mediante una máscara de bits.
+ */
+typedef uint8_t gpio_port_t;
+
+/**
+ * @brief Flancos de un GPIO que pueden notificarse.
+ */
+typedef enum gpio_edge_e {
+    GPIO_EDGE_NONE = 0,    /**< No se notifican cambios. */
+    GPIO_EDGE_RISING = 1,  /**< Se notifican los flancos ascendentes. */
+    GPIO_EDGE_FALLING = 2, /**< Se notifican los flancos descendentes. */
+    GPIO_EDGE_BOTH = 3,    /**< Se notifican ambos flancos. */
+} gpio_edge_t;
+
+/**
+ * @brief Función que se invoca cuando un GPIO presenta un flanco.
+ *
+ * Se ejecuta en el contexto de la rutina de interrupción, por lo que debe ser breve.
+ *
+ * @param gpio Objeto gpio_t que generó el evento.
+ * @param level Estado del pin en el momento de la interrupción.
+ * @param context Puntero provisto por la aplicación al registrar la función.
+ */
+typedef void (*gpio_edge_cb_t)(gpio_t gpio, bool level, void * context);
+
+/**
+ * @brief Configuración inicial de un pin GPIO.
+ *
+ * Una tabla de estas estructuras, declarada como `const` para que resida en memoria de programa,
+ * describe la configuración de todos los pines de la placa y se aplica con gpioConfigureTable().
+ */
+typedef struct gpio_config_s {
+    uint8_t port; /**< Puerto del microcontrolador al que está conectado el pin. */
+    uint8_t bit;  /**< Bit dentro del puerto. */
+    bool output;  /**< Indica si el pin debe ser una salida (true) o una entrada (false). */
+    bool state;   /**< Estado inicial del pin cuando se configura como salida. */
+} gpio_config_t;
+
+#ifdef USE_GPIO_STATS
+/**
+ * @brief Estadísticas de acceso a los pines de un puerto.
+ *
+ * Solo están disponibles cuando se define `USE_GPIO_STATS`. Sin esa definición la biblioteca no
+ * agrega ningún contador ni medición. Con la HAL simulada hal_timestamp() es el tiempo virtual,
+ * que solo avanza con hal_sim_advance(), por lo que `cycles` permanece en cero en la computadora.
+ */
+typedef struct gpio_stats_s {
+    uint32_t writes;     /**< Escrituras de las salidas. */
+    uint32_t reads;      /**< Lecturas del estado de los pines. */
+    uint32_t directions; /**< Cambios de dirección. */
+    uint32_t dropped;    /**< Llamadas a gpioSetState() descartadas por ser el pin una entrada. */
+    uint32_t cycles;     /**< Duración acumulada de los accesos, en cuentas de hal_timestamp(). */
+} gpio_stats_t;
+#endif
+
 /* === Declaraciones de variables públicas =================================================== */
 
 /* No se definen variables globales en este archivo */
 
 /* === Declaraciones de funciones públicas =================================================== */
 
+#ifdef USE_POOL_MEM
+/**
+ * @brief Inicializa el pool del que se toman los objetos GPIO.
+ *
+ * Cuando se define `USE_POOL_MEM` los objetos se crean a partir de un área de memoria provista por
+ * la aplicación, dividida en bloques de tamaño fijo. La creación y destrucción de objetos toman un
+ * tiempo constante y no se utiliza el heap. Esta función debe llamarse antes del primer
+ * gpioCreate().
+ *
+ * @param buffer Área de memoria que se utilizará para almacenar los objetos GPIO.
+ * @param size Tamaño en bytes del área de memoria.
+ *
+ * @return La cantidad de objetos GPIO que se pueden crear con el área provista.
+ */
+size_t gpioPoolInit(void * buffer, size_t size);
+#endif
+
 /**
  * @brief Crea y configura un objeto GPIO.
  *
  * Esta función permite crear un objeto GPIO, especificando el puerto y el bit que se desea
- * controlar.
+ * controlar. Cada pin puede pertenecer a un único objeto a la vez.
  *
  * @param port Puerto del microcontrolador al que está conectado el pin.
  * @param bit Bit dentro del puerto que se desea configurar.
  *
- * @return Un puntero a un objeto gpio_t que representa el pin configurado.
+ * @return Un puntero a un objeto gpio_t que representa el pin configurado, o NULL si el pin no
+ * existe, ya pertenece a otro objeto o no quedan objetos disponibles.
  */
 gpio_t gpioCreate(uint8_t port, uint8_t bit);
 
+/**
+ * @brief Destruye un objeto GPIO.
+ *
+ * Esta función libera el objeto para que pueda ser reutilizado por una nueva llamada a
+ * gpioCreate() y deja el pin libre para otro objeto. El estado del pin en el hardware no se
+ * modifica. Si el objeto ya fue destruido la función no tiene efecto.
+ *
+ * @param gpio Objeto gpio_t que se desea destruir, puede ser NULL.
+ */
+void gpioDestroy(gpio_t gpio);
+
+/**
+ * @brief Obtiene el identificador compacto de un objeto GPIO.
+ *
+ * El identificador es la posición del objeto en el arreglo de instancias (o en el pool), por lo que
+ * es un número pequeño que permite registrar eventos sin almacenar punteros. Con memoria dinámica
+ * el identificador es un número secuencial asignado al crear el objeto.
+ *
+ * @param gpio Objeto gpio_t del que se desea conocer el identificador.
+ *
+ * @return El identificador del objeto.
+ */
+uint16_t gpioGetId(gpio_t gpio);
+
 /**
  * @brief Configura un GPIO como salida.
  *
@@ -110,6 +213,289 @@ void gpioSetState(gpio_t gpio, bool state);
  */
 bool gpioGetState(gpio_t gpio);
 
+/**
+ * @brief Invierte el estado de un GPIO configurado como salida.
+ *
+ * El nuevo estado se calcula a partir del último valor escrito en el pin, por lo que no es
+ * necesario leer el hardware.
+ *
+ * @param gpio Objeto gpio_t que representa el pin a modificar.
+ */
+void gpioToggle(gpio_t gpio);
+
+/**
+ * @brief Obtiene el último estado escrito en un GPIO.
+ *
+ * Esta función devuelve el valor del registro de salida que mantiene la biblioteca, sin acceder al
+ * hardware. Para conocer el nivel real presente en el pin se debe utilizar gpioGetState().
+ *
+ * @param gpio Objeto gpio_t que representa el pin consultado.
+ *
+ * @return El último estado escrito en el pin (true = alto, false = bajo).
+ */
+bool gpioGetOutputLatch(gpio_t gpio);
+
+/**
+ * @brief Registra una función que se invoca ante los flancos de un GPIO.
+ *
+ * Esta función habilita la interrupción del pin en los flancos indicados, evitando tener que
+ * consultar el estado con gpioGetState(). Todos los pines de un puerto se atienden en una única
+ * interrupción, con un costo proporcional a la cantidad de pines que cambiaron.
+ *
+ * @param gpio Objeto gpio_t cuyo pin se desea observar.
+ * @param edge Flancos que se desean notificar, GPIO_EDGE_NONE deshabilita la notificación.
+ * @param callback Función que se invoca ante cada flanco, NULL deshabilita la notificación.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ *
+ * @return true si la notificación se configuró, false si el objeto ya fue destruido, si el pin
+ * pertenece a un puerto virtual o si la plataforma no tiene recursos para observarlo. Deshabilitar
+ * la notificación de un pin virtual siempre tiene éxito.
+ */
+bool gpioOnEdge(gpio_t gpio, gpio_edge_t edge, gpio_edge_cb_t callback, void * context);
+
+/**
+ * @brief Busca el objeto GPIO que controla un pin.
+ *
+ * La búsqueda se resuelve con un único acceso a una tabla indexada por puerto y bit.
+ *
+ * @param port Puerto del pin.
+ * @param bit Bit del pin dentro del puerto.
+ *
+ * @return El objeto dueño del pin o NULL si el pin no pertenece a ningún objeto.
+ */
+gpio_t gpioFind(gpio_port_t port, uint8_t bit);
+
+/**
+ * @brief Obtiene los pines de un puerto que pertenecen a algún objeto GPIO.
+ *
+ * @param port Puerto consultado.
+ *
+ * @return Una máscara con un bit en uno por cada pin que tiene dueño.
+ */
+uint32_t gpioPortUsed(gpio_port_t port);
+
+/**
+ * @brief Configura un conjunto de pines a partir de una tabla.
+ *
+ * Esta función agrupa las entradas de la tabla por puerto y realiza una única escritura de salida
+ * y una única escritura de dirección por cada puerto involucrado. El estado inicial de las salidas
+ * se escribe antes de cambiar la dirección, de forma que los pines no presentan pulsos espurios.
+ * Los objetos gpio_t que ya controlan alguno de los pines, y los creados después de esta llamada,
+ * adoptan la dirección configurada. Las entradas con un puerto o un bit fuera de rango se ignoran.
+ *
+ * @param table Tabla con la configuración de cada pin.
+ * @param count Cantidad de entradas de la tabla.
+ */
+void gpioConfigureTable(const gpio_config_t * table, size_t count);
+
+/**
+ * @brief Obtiene el puerto al que pertenece un GPIO.
+ *
+ * @param gpio Objeto gpio_t del que se desea conocer el puerto.
+ *
+ * @return El puerto del pin, utilizable con las funciones de puerto.
+ */
+gpio_port_t gpioGetPort(gpio_t gpio);
+
+/**
+ * @brief Obtiene la máscara de bits que corresponde a un GPIO dentro de su puerto.
+ *
+ * @param gpio Objeto gpio_t del que se desea conocer la máscara.
+ *
+ * @return Máscara con un único bit activo en la posición del pin.
+ */
+uint32_t gpioGetMask(gpio_t gpio);
+
+/**
+ * @brief Pone en alto varios pines de un puerto en una única operación.
+ *
+ * Si el puerto no existe la función no tiene efecto.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben pasar a estado alto.
+ */
+void gpioPortSet(gpio_port_t port, uint32_t mask);
+
+/**
+ * @brief Pone en bajo varios pines de un puerto en una única operación.
+ *
+ * Si el puerto no existe la función no tiene efecto.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben pasar a estado bajo.
+ */
+void gpioPortClear(gpio_port_t port, uint32_t mask);
+
+/**
+ * @brief Invierte el estado de varios pines de un puerto en una única operación.
+ *
+ * Si el puerto no existe la función no tiene efecto.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben cambiar de estado.
+ */
+void gpioPortToggle(gpio_port_t port, uint32_t mask);
+
+/**
+ * @brief Escribe un valor sobre varios pines de un puerto en una única operación.
+ *
+ * Esta función permite actualizar un bus paralelo completo: los pines seleccionados por `mask`
+ * toman el valor del bit correspondiente de `value` y todos cambian en el mismo instante, salvo en
+ * los casos indicados en hal_gpio_set_port_mask(). Los pines fuera de la máscara no se modifican.
+ * Si el puerto no existe la función no tiene efecto.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que se deben escribir.
+ * @param value Valor que se desea escribir en los pines seleccionados.
+ */
+void gpioPortWrite(gpio_port_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Lee el estado de todos los pines de un puerto a la vez.
+ *
+ * Todos los pines se muestrean en el mismo instante con una única lectura del registro de entrada,
+ * por lo que el resultado es una imagen coherente del puerto.
+ *
+ * @param port Puerto que se desea leer.
+ *
+ * @return El estado de los pines del puerto, un bit por pin, o cero si el puerto no existe.
+ */
+uint32_t gpioPortRead(gpio_port_t port);
+
+/**
+ * @brief Configura la dirección de varios pines de un puerto en una única operación.
+ *
+ * Los pines seleccionados por `mask` quedan como salida si el bit correspondiente de `outputs` está
+ * en uno y como entrada en caso contrario; el resto no se modifica. Los objetos GPIO de esos pines
+ * adoptan la nueva dirección. Si el puerto no existe la función no tiene efecto.
+ *
+ * @param port Puerto que se desea configurar.
+ * @param mask Máscara con los pines que se deben configurar.
+ * @param outputs Máscara con los pines que deben quedar como salida.
+ */
+void gpioPortSetOutput(gpio_port_t port, uint32_t mask, uint32_t outputs);
+
+/**
+ * @brief Obtiene el último estado escrito en las salidas de un puerto.
+ *
+ * Al igual que gpioGetOutputLatch(), devuelve el registro sombra del puerto sin leer el hardware.
+ *
+ * @param port Puerto consultado.
+ *
+ * @return El último estado escrito, un bit por pin, o cero si el puerto no existe.
+ */
+uint32_t gpioPortGetOutputLatch(gpio_port_t port);
+
+/**
+ * @brief Reúne el estado de varios objetos GPIO, de uno o más puertos, en una palabra compacta.
+ *
+ * Cada puerto distinto se lee una única vez, por lo que los pines de un mismo puerto se muestrean
+ * en el mismo instante.
+ *
+ * @param pins Lista de objetos GPIO; el primero corresponde al bit 0 del resultado.
+ * @param count Cantidad de objetos de la lista, como máximo 32.
+ *
+ * @return El estado de los pines, un bit por objeto en el orden de la lista.
+ */
+uint32_t gpioGather(const gpio_t * pins, size_t count);
+
+/**
+ * @brief Indica que las salidas de un puerto fueron modificadas sin pasar por la biblioteca.
+ *
+ * Los módulos que escriben el puerto por otros medios, como una transferencia DMA, deben llamar a
+ * esta función para que la omisión de escrituras redundantes no descarte la próxima escritura de
+ * esos pines. Solo tiene efecto cuando se define `USE_WRITE_ELISION` y el puerto existe.
+ *
+ * @param port Puerto cuyas salidas fueron modificadas.
+ * @param mask Máscara con los pines cuyo estado dejó de ser conocido.
+ */
+void gpioPortInvalidate(gpio_port_t port, uint32_t mask);
+
+/**
+ * @brief Prepara los pines para un modo de bajo consumo.
+ *
+ * Todas las salidas que pertenecen a algún objeto pasan a ser entradas, con una única escritura
+ * del registro de dirección por puerto, salvo las indicadas en `wake`, que siguen manejando su
+ * nivel. Las entradas no se modifican, por lo que conservan siempre su configuración y sus
+ * notificaciones de flanco y no necesitan figurar en `wake`, que solo tiene efecto sobre las
+ * salidas. La biblioteca conserva la dirección y el estado configurados en sus copias en memoria,
+ * por lo que no es necesario leer el hardware. Los puertos que pertenecen a otro núcleo, con
+ * `USE_GPIO_THREAD_SAFE`, y los puertos virtuales no se modifican.
+ *
+ * Las transferencias DMA hacia los puertos deben detenerse antes de llamar a esta función.
+ *
+ * @param wake Arreglo con las salidas de cada puerto que se mantienen durante el bajo consumo, a
+ * partir del puerto 0, o NULL si no se mantiene ninguna.
+ * @param count Cantidad de posiciones del arreglo.
+ */
+void gpioSuspend(const uint32_t * wake, size_t count);
+
+/**
+ * @brief Restablece los pines después de un modo de bajo consumo.
+ *
+ * Cada puerto se restablece con una escritura del registro de salida seguida de una del registro
+ * de dirección, por lo que las salidas recuperan su nivel antes de volver a ser manejadas. No es
+ * necesario que el hardware conserve los registros durante el modo de bajo consumo.
+ */
+void gpioResume(void);
+
+#ifdef USE_GPIO_THREAD_SAFE
+/**
+ * @brief Asigna un puerto al núcleo que ejecuta la función.
+ *
+ * Cuando se define `USE_GPIO_THREAD_SAFE` la creación y la destrucción de objetos pueden llamarse
+ * desde varios núcleos a la vez y las salidas se escriben con los accesos atómicos de
+ * `USE_ATOMIC_GPIO`. Un puerto asignado a un núcleo solo puede modificarse desde ese núcleo: las
+ * escrituras y los cambios de dirección que realiza otro núcleo se descartan y se cuentan como
+ * descartadas en las estadísticas, por lo que cada núcleo maneja sus puertos sin cerrojos. Los
+ * puertos sin dueño pueden modificarse desde cualquier núcleo.
+ *
+ * @param port Puerto que se desea reclamar.
+ *
+ * @return true si el puerto quedó asignado al núcleo, false si pertenece a otro núcleo.
+ */
+bool gpioPortClaim(gpio_port_t port);
+
+/**
+ * @brief Libera un puerto asignado al núcleo que ejecuta la función.
+ *
+ * @param port Puerto que se desea liberar, si pertenece a otro núcleo no se modifica.
+ */
+void gpioPortRelease(gpio_port_t port);
+#endif
+
+#ifdef USE_WRITE_ELISION
+/**
+ * @brief Obtiene la cantidad de escrituras redundantes omitidas.
+ *
+ * Cuando se define `USE_WRITE_ELISION`, gpioSetOutput(), gpioSetState(), gpioPortSet(),
+ * gpioPortClear(), gpioPortWrite() y gpioConfigureTable() comparan el pedido con la dirección y
+ * el estado que la biblioteca escribió por última vez, y no acceden al hardware si ningún pin
+ * cambia. Los pines cuyo estado todavía no fue escrito por la biblioteca siempre se escriben.
+ *
+ * @return La cantidad de escrituras y cambios de dirección omitidos desde el arranque.
+ */
+uint32_t gpioElidedWrites(void);
+#endif
+
+#ifdef USE_GPIO_STATS
+/**
+ * @brief Obtiene una copia de las estadísticas de acceso de cada puerto.
+ *
+ * @param snapshot Arreglo donde se copian las estadísticas, una posición por puerto a partir del
+ * puerto 0.
+ * @param count Cantidad de posiciones del arreglo.
+ *
+ * @return La cantidad de puertos copiados.
+ */
+size_t gpioStatsSnapshot(gpio_stats_t * snapshot, size_t count);
+
+/**
+ * @brief Pone en cero las estadísticas de acceso de todos los puertos.
+ */
+void gpioStatsReset(void);
+#endif
+
 /* === Fin de la documentación ============================================================= */
 
 #ifdef __cplusplus
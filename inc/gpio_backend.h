@@ -0,0 +1,143 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_BACKEND_H
+#define GPIO_BACKEND_H
+
+/**
+ * @file gpio_backend.h
+ * @brief Puertos virtuales implementados por expansores externos.
+ *
+ * Cuando se define GPIO_VIRTUAL_PORTS con un valor mayor que cero, los puertos a partir de
+ * HAL_GPIO_PORTS no corresponden al microcontrolador sino a un controlador asociado con
+ * gpioBackendAttach(), por ejemplo un registro de desplazamiento o un expansor I2C. Los objetos
+ * gpio_t de esos puertos se crean y se usan con las mismas funciones que los de los puertos
+ * nativos.
+ *
+ * Las escrituras sobre un puerto virtual solo actualizan las copias en memoria de la biblioteca y
+ * marcan el puerto como pendiente. gpioFlush() envía a cada controlador el estado de todos sus
+ * puertos pendientes en una única transacción. Las lecturas acceden al controlador en el momento.
+ * Los puertos virtuales no admiten notificaciones de flanco, y las funciones de gpio_fast.h no
+ * tienen efecto sobre sus pines.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+#include "hal.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef GPIO_VIRTUAL_PORTS
+#define GPIO_VIRTUAL_PORTS 0 /**< Cantidad de puertos virtuales, cero los deshabilita. */
+#endif
+
+/** Cantidad total de puertos, nativos y virtuales. */
+#define GPIO_PORTS (HAL_GPIO_PORTS + GPIO_VIRTUAL_PORTS)
+
+/** Número de puerto del puerto virtual indicado, a partir de cero. */
+#define GPIO_VIRTUAL_PORT(index) (HAL_GPIO_PORTS + (index))
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Operaciones de un controlador de puertos virtuales.
+ *
+ * Un controlador maneja uno o más puertos virtuales consecutivos. Las funciones reciben el
+ * contexto entregado en gpioBackendAttach() y el estado de todos los puertos del controlador, para
+ * que puedan transferirlo en una única transacción del bus.
+ */
+typedef struct gpio_backend_s {
+    /**
+     * @brief Escribe las salidas de todos los puertos del controlador.
+     *
+     * @param context Contexto del controlador.
+     * @param outputs Estado de las salidas de cada puerto, a partir del primero.
+     * @param count Cantidad de puertos del controlador.
+     */
+    void (*write)(void * context, const uint32_t * outputs, uint8_t count);
+
+    /**
+     * @brief Escribe la dirección de todos los puertos del controlador, puede ser NULL.
+     *
+     * @param context Contexto del controlador.
+     * @param outputs Pines configurados como salida en cada puerto, a partir del primero.
+     * @param count Cantidad de puertos del controlador.
+     */
+    void (*direction)(void * context, const uint32_t * outputs, uint8_t count);
+
+    /**
+     * @brief Lee el nivel de los pines de un puerto, puede ser NULL.
+     *
+     * Si no se provee, la lectura devuelve el último estado escrito en las salidas.
+     *
+     * @param context Contexto del controlador.
+     * @param index Puerto dentro del controlador, a partir de cero.
+     * @return uint32_t Nivel de los pines del puerto.
+     */
+    uint32_t (*read)(void * context, uint8_t index);
+} gpio_backend_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Asocia un controlador a un conjunto de puertos virtuales consecutivos.
+ *
+ * Los puertos quedan marcados como pendientes, por lo que el siguiente gpioFlush() envía al
+ * controlador la dirección y el estado registrados en la biblioteca.
+ *
+ * @param port Primer puerto del controlador, obtenido con GPIO_VIRTUAL_PORT().
+ * @param count Cantidad de puertos del controlador.
+ * @param backend Operaciones del controlador, deben permanecer válidas mientras se usen.
+ * @param context Puntero que se entrega a las operaciones del controlador.
+ * @return bool true si el controlador se asoció, false si los puertos no son virtuales o ya
+ * tienen un controlador.
+ */
+bool gpioBackendAttach(gpio_port_t port, uint8_t count, const gpio_backend_t * backend,
+                       void * context);
+
+/**
+ * @brief Envía a los controladores el estado de los puertos virtuales pendientes.
+ *
+ * Cada controlador recibe como máximo una escritura de dirección y una de salidas, sin importar
+ * cuántos pines cambiaron desde el envío anterior. Sin puertos virtuales la función no hace nada.
+ */
+void gpioFlush(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_BACKEND_H */
@@ -0,0 +1,125 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_EVENTS_H
+#define GPIO_EVENTS_H
+
+/**
+ * @file gpio_events.h
+ * @brief Cola de eventos de flanco de los GPIO para su procesamiento fuera de interrupción.
+ *
+ * Este archivo define una cola circular sin bloqueos con un único productor, la rutina de
+ * interrupción de los GPIO, y un único consumidor, el lazo principal. Cada evento registra el
+ * identificador del objeto que lo generó, el estado del pin y el instante en que ocurrió, de forma
+ * que ambos contextos se comunican sin deshabilitar interrupciones.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef GPIO_EVENTS_SIZE
+#define GPIO_EVENTS_SIZE 32 /**< Capacidad de la cola de eventos, debe ser una potencia de dos. */
+#endif
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Evento de flanco registrado en la cola.
+ */
+typedef struct gpio_event_s {
+    uint16_t id;        /**< Identificador del objeto GPIO que generó el evento, ver gpioGetId(). */
+    bool level;         /**< Estado del pin en el momento del evento. */
+    uint32_t timestamp; /**< Valor del contador de tiempo de la plataforma al ocurrir el evento. */
+} gpio_event_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Registra los flancos de un GPIO en la cola de eventos.
+ *
+ * Esta función configura la notificación de flancos del pin para que cada evento se agregue a la
+ * cola en lugar de invocar una función de la aplicación.
+ *
+ * @param gpio Objeto gpio_t cuyo pin se desea observar.
+ * @param edge Flancos que se desean registrar, GPIO_EDGE_NONE deja de registrarlos.
+ *
+ * @return true si la notificación se configuró, false si el objeto ya fue destruido, si el pin
+ * pertenece a un puerto virtual o si la plataforma no tiene recursos para observarlo.
+ */
+bool gpioEventsWatch(gpio_t gpio, gpio_edge_t edge);
+
+/**
+ * @brief Agrega un evento a la cola.
+ *
+ * Esta función tiene el formato de gpio_edge_cb_t, por lo que también puede registrarse
+ * directamente con gpioOnEdge(). Debe invocarse siempre desde el mismo contexto de interrupción.
+ * Si la cola está llena el evento se descarta y se incrementa el contador de eventos perdidos.
+ *
+ * @param gpio Objeto gpio_t que generó el evento.
+ * @param level Estado del pin en el momento del evento.
+ * @param context No se utiliza.
+ */
+void gpioEventsRecord(gpio_t gpio, bool level, void * context);
+
+/**
+ * @brief Retira de la cola los eventos pendientes.
+ *
+ * Esta función copia hasta `max` eventos, en el orden en que ocurrieron, y los libera de la cola
+ * con una única actualización del índice de lectura. Debe invocarse siempre desde el mismo
+ * contexto, habitualmente el lazo principal.
+ *
+ * @param buffer Arreglo donde se copian los eventos.
+ * @param max Cantidad máxima de eventos que se pueden copiar en el arreglo.
+ *
+ * @return La cantidad de eventos copiados.
+ */
+size_t gpioEventsDrain(gpio_event_t * buffer, size_t max);
+
+/**
+ * @brief Obtiene la cantidad de eventos descartados porque la cola estaba llena.
+ *
+ * @return La cantidad de eventos perdidos desde el arranque del sistema.
+ */
+uint32_t gpioEventsDropped(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_EVENTS_H */
@@ -0,0 +1,136 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_FAST_H
+#define GPIO_FAST_H
+
+/**
+ * @file gpio_fast.h
+ * @brief Versiones en línea de las funciones de acceso a un GPIO para caminos críticos.
+ *
+ * Cuando se define `USE_FAST_GPIO` cada objeto GPIO guarda, desde su creación, la máscara del pin
+ * y las direcciones de los registros de su puerto. Las funciones de este archivo utilizan esos
+ * datos para que una escritura se reduzca a un único acceso al registro, sin llamadas a funciones.
+ *
+ * Estas funciones no verifican la dirección del pin ni actualizan el registro sombra utilizado por
+ * gpioToggle() y gpioGetOutputLatch(), por lo que están pensadas para pines de salida que se
+ * manejan exclusivamente por este camino, por ejemplo desde una rutina de interrupción. Sobre un
+ * pin de un puerto virtual las funciones no tienen efecto y la lectura siempre devuelve false.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include "gpio.h"
+#include "hal.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef USE_FAST_GPIO
+#error "gpio_fast.h requiere que se defina USE_FAST_GPIO"
+#endif
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Datos precalculados para el acceso rápido a un GPIO.
+ *
+ * Esta estructura es el primer campo del objeto GPIO, por lo que un gpio_t puede convertirse en un
+ * puntero a ella. Se completa en gpioCreate() y no debe ser modificada por la aplicación.
+ */
+struct gpio_fast_s {
+#if HAL_GPIO_DIRECT_ACCESS
+    volatile uint32_t * set;         /**< Registro que pone en alto los bits escritos. */
+    volatile uint32_t * clear;       /**< Registro que pone en bajo los bits escritos. */
+    volatile uint32_t * toggle;      /**< Registro que invierte los bits escritos. */
+    const volatile uint32_t * input; /**< Registro con el estado de los pines del puerto. */
+#else
+    uint8_t port; /**< Puerto donde se encuentra el pin GPIO. */
+#endif
+    uint32_t mask; /**< Máscara del pin dentro de su puerto, cero en un puerto virtual. */
+};
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Establece el estado de un GPIO de salida con un único acceso al registro.
+ *
+ * @param gpio Objeto gpio_t que representa el pin, previamente configurado como salida.
+ * @param state Estado deseado para el pin (true = alto, false = bajo).
+ */
+static inline void gpioFastSetState(gpio_t gpio, bool state) {
+    const struct gpio_fast_s * fast = (const struct gpio_fast_s *)gpio;
+
+#if HAL_GPIO_DIRECT_ACCESS
+    *(state ? fast->set : fast->clear) = fast->mask;
+#else
+    hal_gpio_set_port_mask(fast->port, state ? fast->mask : 0, state ? 0 : fast->mask);
+#endif
+}
+
+/**
+ * @brief Invierte el estado de un GPIO de salida con un único acceso al registro.
+ *
+ * @param gpio Objeto gpio_t que representa el pin, previamente configurado como salida.
+ */
+static inline void gpioFastToggle(gpio_t gpio) {
+    const struct gpio_fast_s * fast = (const struct gpio_fast_s *)gpio;
+
+#if HAL_GPIO_DIRECT_ACCESS
+    *fast->toggle = fast->mask;
+#else
+    hal_gpio_toggle_port_mask(fast->port, fast->mask);
+#endif
+}
+
+/**
+ * @brief Obtiene el estado de un GPIO con un único acceso al registro.
+ *
+ * @param gpio Objeto gpio_t que representa el pin cuyo estado se desea leer.
+ *
+ * @return El estado actual del pin (true = alto, false = bajo).
+ */
+static inline bool gpioFastGetState(gpio_t gpio) {
+    const struct gpio_fast_s * fast = (const struct gpio_fast_s *)gpio;
+
+#if HAL_GPIO_DIRECT_ACCESS
+    return (*fast->input & fast->mask) != 0;
+#else
+    return (hal_gpio_get_port(fast->port) & fast->mask) != 0;
+#endif
+}
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_FAST_H */
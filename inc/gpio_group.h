@@ -0,0 +1,125 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_GROUP_H
+#define GPIO_GROUP_H
+
+/**
+ * @file gpio_group.h
+ * @brief Grupos de pines GPIO que se escriben y se leen como un único valor.
+ *
+ * Este archivo define un grupo formado por una lista de objetos GPIO, que pueden pertenecer a
+ * distintos puertos y estar en cualquier orden. El pin i de la lista corresponde al bit i del
+ * valor del grupo. Al crear el grupo se precalculan, para cada puerto involucrado, la máscara de
+ * sus pines y la forma de mover los bits del valor a sus posiciones en el puerto, de manera que
+ * escribir o leer el grupo requiere un acceso por puerto y unas pocas operaciones de
+ * desplazamiento y máscara.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#define GPIO_GROUP_MAX_PINS 32 /**< Máxima cantidad de pines de un grupo. */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef gpio_group_t
+ * @brief Tipo de dato para representar un grupo de pines GPIO.
+ */
+typedef struct gpio_group_s * gpio_group_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un grupo a partir de una lista de objetos GPIO.
+ *
+ * Los objetos deben existir mientras se utilice el grupo. El grupo no modifica la dirección de
+ * los pines. La lista no es válida si contiene NULL o si un mismo pin aparece más de una vez.
+ *
+ * @param pins Lista de objetos GPIO; el primero corresponde al bit 0 del valor del grupo.
+ * @param count Cantidad de objetos de la lista, entre 1 y `GPIO_GROUP_MAX_PINS`.
+ *
+ * @return El grupo creado o NULL si la lista no es válida o no quedan grupos disponibles.
+ */
+gpio_group_t gpioGroupCreate(const gpio_t * pins, size_t count);
+
+/**
+ * @brief Escribe un valor en los pines de un grupo.
+ *
+ * Los pines de cada puerto cambian a la vez, con una única escritura por puerto.
+ *
+ * @param group Grupo que se desea escribir.
+ * @param value Valor que se escribe; el bit i corresponde al pin i de la lista de creación.
+ */
+void gpioGroupWrite(gpio_group_t group, uint32_t value);
+
+/**
+ * @brief Lee el valor de los pines de un grupo.
+ *
+ * Los pines de cada puerto se muestrean en el mismo instante, con una única lectura por puerto.
+ *
+ * @param group Grupo que se desea leer.
+ *
+ * @return El estado de los pines; el bit i corresponde al pin i de la lista de creación.
+ */
+uint32_t gpioGroupRead(gpio_group_t group);
+
+/**
+ * @brief Obtiene la cantidad de pines de un grupo.
+ *
+ * @param group Grupo consultado.
+ *
+ * @return La cantidad de pines del grupo.
+ */
+uint8_t gpioGroupWidth(gpio_group_t group);
+
+/**
+ * @brief Obtiene la cantidad de grupos que todavía pueden crearse.
+ *
+ * Permite verificar los recursos antes de crear varios grupos, ya que los grupos no se destruyen.
+ *
+ * @return La cantidad de grupos disponibles.
+ */
+uint8_t gpioGroupAvailable(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_GROUP_H */
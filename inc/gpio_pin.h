@@ -0,0 +1,291 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_PIN_H
+#define GPIO_PIN_H
+
+/**
+ * @file gpio_pin.h
+ * @brief Descriptores de pines GPIO definidos en tiempo de compilación.
+ *
+ * Este archivo permite manejar pines cuyo puerto y bit son constantes conocidas al compilar, sin
+ * crear un objeto gpio_t. El descriptor codifica el puerto y el bit en un entero y las funciones
+ * son en línea sobre las funciones de puerto de gpio.h, por lo que el compilador reemplaza el
+ * puerto y la máscara por valores inmediatos y el pin no ocupa memoria RAM. Al pasar por esas
+ * funciones los descriptores mantienen los registros sombra, la omisión de escrituras, las
+ * estadísticas, la traza, la propiedad de los puertos y los puertos virtuales igual que un objeto.
+ *
+ * El descriptor ocupa dos bytes, por lo que también sirve como referencia compacta a un pin
+ * dentro de las estructuras de los controladores: gpioGetPin() obtiene el descriptor de un objeto
+ * gpio_t, y al incluir este archivo las funciones gpioSetOutput(), gpioSetState(),
+ * gpioGetState(), gpioToggle(), gpioGetOutputLatch(), gpioOnEdge(), gpioGather(), gpioGetPort() y
+ * gpioGetMask() aceptan indistintamente un objeto o un descriptor. Con un descriptor el puerto y
+ * la máscara se calculan con desplazamientos, sin leer la memoria.
+ *
+ * Los módulos que conservan una referencia al pin, como los grupos, las acciones temporizadas, el
+ * PWM y el teclado, solo aceptan objetos; gpioFind() obtiene el objeto dueño de un descriptor.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+#include "gpio.h"
+#include "gpio_backend.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#define GPIO_PIN_PORT_SHIFT 5 /**< Posición del número de puerto dentro del descriptor. */
+#define GPIO_PIN_BIT_MASK   0x1F /**< Máscara del número de bit dentro del descriptor. */
+
+/**
+ * @brief Verifica en tiempo de compilación que el puerto y el bit de un pin sean válidos.
+ *
+ * Se expande a una expresión constante de valor cero, de forma que puede sumarse al descriptor sin
+ * modificarlo. Si el puerto o el bit están fuera de rango la compilación se detiene.
+ */
+#define GPIO_PIN_CHECK(port, bit)                                                                  \
+    (0 * sizeof(struct {                                                                           \
+         _Static_assert((port) < GPIO_PORTS, "Puerto GPIO fuera de rango");                        \
+         _Static_assert((bit) < HAL_GPIO_PORT_WIDTH, "Bit GPIO fuera de rango");                   \
+         int unused;                                                                               \
+     }))
+
+/**
+ * @brief Construye el descriptor de un pin a partir de su puerto y su bit.
+ *
+ * El resultado es una expresión constante, por lo que puede utilizarse para inicializar variables
+ * `static const` que el compilador ubica en memoria de programa.
+ *
+ * @param port Puerto del microcontrolador al que está conectado el pin.
+ * @param bit Bit dentro del puerto.
+ */
+#define GPIO_PIN(port, bit)                                                                        \
+    ((gpio_pin_t)((((port) << GPIO_PIN_PORT_SHIFT) | (bit)) + GPIO_PIN_CHECK(port, bit)))
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef gpio_pin_t
+ * @brief Descriptor de un pin GPIO con el puerto y el bit codificados en un entero.
+ */
+typedef uint16_t gpio_pin_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Obtiene el puerto de un descriptor de pin.
+ *
+ * @param pin Descriptor del pin.
+ *
+ * @return El puerto al que pertenece el pin.
+ */
+static inline uint8_t gpioPinPort(gpio_pin_t pin) {
+    return (uint8_t)(pin >> GPIO_PIN_PORT_SHIFT);
+}
+
+/**
+ * @brief Obtiene el bit de un descriptor de pin.
+ *
+ * @param pin Descriptor del pin.
+ *
+ * @return El bit del pin dentro de su puerto.
+ */
+static inline uint8_t gpioPinBit(gpio_pin_t pin) {
+    return (uint8_t)(pin & GPIO_PIN_BIT_MASK);
+}
+
+/**
+ * @brief Obtiene la máscara de un descriptor de pin dentro de su puerto.
+ *
+ * @param pin Descriptor del pin.
+ *
+ * @return Máscara con un único bit activo en la posición del pin.
+ */
+static inline uint32_t gpioPinMask(gpio_pin_t pin) {
+    return (uint32_t)1 << gpioPinBit(pin);
+}
+
+/**
+ * @brief Configura un pin como salida o como entrada.
+ *
+ * Si el pin pertenece a un objeto gpio_t, el objeto adopta la nueva dirección.
+ *
+ * @param pin Descriptor del pin.
+ * @param output Valor booleano que indica si el pin debe ser una salida (true) o no (false).
+ */
+static inline void gpioPinSetOutput(gpio_pin_t pin, bool output) {
+    gpioPortSetOutput(gpioPinPort(pin), gpioPinMask(pin), output ? UINT32_MAX : 0);
+}
+
+/**
+ * @brief Establece el estado de un pin configurado como salida.
+ *
+ * @param pin Descriptor del pin.
+ * @param state Estado deseado para el pin (true = alto, false = bajo).
+ */
+static inline void gpioPinSetState(gpio_pin_t pin, bool state) {
+    gpioPortWrite(gpioPinPort(pin), gpioPinMask(pin), state ? UINT32_MAX : 0);
+}
+
+/**
+ * @brief Invierte el estado de un pin configurado como salida.
+ *
+ * @param pin Descriptor del pin.
+ */
+static inline void gpioPinToggle(gpio_pin_t pin) {
+    gpioPortToggle(gpioPinPort(pin), gpioPinMask(pin));
+}
+
+/**
+ * @brief Obtiene el estado de un pin.
+ *
+ * @param pin Descriptor del pin.
+ *
+ * @return El estado actual del pin (true = alto, false = bajo).
+ */
+static inline bool gpioPinGetState(gpio_pin_t pin) {
+    return (gpioPortRead(gpioPinPort(pin)) & gpioPinMask(pin)) != 0;
+}
+
+/**
+ * @brief Obtiene el último estado escrito en un pin.
+ *
+ * @param pin Descriptor del pin.
+ *
+ * @return El último estado escrito en el pin (true = alto, false = bajo).
+ */
+static inline bool gpioPinGetOutputLatch(gpio_pin_t pin) {
+    return (gpioPortGetOutputLatch(gpioPinPort(pin)) & gpioPinMask(pin)) != 0;
+}
+
+/**
+ * @brief Registra una función que se invoca ante los flancos de un pin.
+ *
+ * La notificación se configura sobre el objeto gpio_t dueño del pin, que es el que recibe la
+ * función en cada flanco.
+ *
+ * @param pin Descriptor del pin.
+ * @param edge Flancos que se desean notificar, GPIO_EDGE_NONE deshabilita la notificación.
+ * @param callback Función que se invoca ante cada flanco, NULL deshabilita la notificación.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ *
+ * @return true si la notificación se configuró, false si el pin no pertenece a ningún objeto o en
+ * los casos indicados en gpioOnEdge().
+ */
+static inline bool gpioPinOnEdge(gpio_pin_t pin, gpio_edge_t edge, gpio_edge_cb_t callback,
+                                 void * context) {
+    gpio_t owner = gpioFind(gpioPinPort(pin), gpioPinBit(pin));
+
+    return owner != NULL && gpioOnEdge(owner, edge, callback, context);
+}
+
+/**
+ * @brief Reúne el estado de varios pines, de uno o más puertos, en una palabra compacta.
+ *
+ * Al igual que gpioGather(), cada puerto distinto se lee una única vez.
+ *
+ * @param pins Lista de descriptores; el primero corresponde al bit 0 del resultado.
+ * @param count Cantidad de descriptores de la lista, como máximo 32.
+ *
+ * @return El estado de los pines, un bit por descriptor en el orden de la lista.
+ */
+static inline uint32_t gpioPinGather(const gpio_pin_t * pins, size_t count) {
+    uint32_t levels[GPIO_PORTS];
+    uint32_t sampled = 0;
+    uint32_t result = 0;
+
+    if (count > 32) {
+        count = 32;
+    }
+    for (size_t index = 0; index < count; index++) {
+        uint8_t port = gpioPinPort(pins[index]);
+
+        if ((sampled & ((uint32_t)1 << port)) == 0) {
+            levels[port] = gpioPortRead(port); /**< Primera aparición del puerto. */
+            sampled |= (uint32_t)1 << port;
+        }
+        result |= ((levels[port] >> gpioPinBit(pins[index])) & 1) << index;
+    }
+    return result;
+}
+
+/**
+ * @brief Obtiene el descriptor compacto del pin de un objeto GPIO.
+ *
+ * El descriptor de un pin de un puerto virtual también es válido, ya que las funciones de este
+ * archivo acceden al puerto a través de gpio.h.
+ *
+ * @param gpio Objeto gpio_t consultado.
+ *
+ * @return El descriptor con el puerto y el bit del pin.
+ */
+static inline gpio_pin_t gpioGetPin(gpio_t gpio) {
+    return (gpio_pin_t)((gpioGetPort(gpio) << GPIO_PIN_PORT_SHIFT) |
+                        (uint8_t)__builtin_ctz(gpioGetMask(gpio)));
+}
+
+#ifndef __cplusplus
+/**
+ * @name Funciones que aceptan un objeto o un descriptor
+ *
+ * Estas macros reemplazan las funciones homónimas de gpio.h y eligen en tiempo de compilación, a
+ * partir del tipo del primer argumento, la función de este archivo si es un gpio_pin_t o la de
+ * gpio.h en cualquier otro caso.
+ * @{
+ */
+#define gpioSetOutput(gpio, output)                                                                \
+    _Generic((gpio), gpio_pin_t: gpioPinSetOutput, default: gpioSetOutput)(gpio, output)
+#define gpioSetState(gpio, state)                                                                  \
+    _Generic((gpio), gpio_pin_t: gpioPinSetState, default: gpioSetState)(gpio, state)
+#define gpioGetState(gpio)                                                                         \
+    _Generic((gpio), gpio_pin_t: gpioPinGetState, default: gpioGetState)(gpio)
+#define gpioToggle(gpio)  _Generic((gpio), gpio_pin_t: gpioPinToggle, default: gpioToggle)(gpio)
+#define gpioGetPort(gpio) _Generic((gpio), gpio_pin_t: gpioPinPort, default: gpioGetPort)(gpio)
+#define gpioGetMask(gpio) _Generic((gpio), gpio_pin_t: gpioPinMask, default: gpioGetMask)(gpio)
+#define gpioGetOutputLatch(gpio)                                                                   \
+    _Generic((gpio), gpio_pin_t: gpioPinGetOutputLatch, default: gpioGetOutputLatch)(gpio)
+#define gpioOnEdge(gpio, edge, callback, context)                                                  \
+    _Generic((gpio), gpio_pin_t: gpioPinOnEdge, default: gpioOnEdge)(gpio, edge, callback, context)
+#define gpioGather(pins, count)                                                                    \
+    _Generic((pins), const gpio_pin_t *: gpioPinGather, gpio_pin_t *: gpioPinGather,               \
+             default: gpioGather)(pins, count)
+/** @} */
+#endif
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_PIN_H */
@@ -0,0 +1,139 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_STREAM_H
+#define GPIO_STREAM_H
+
+/**
+ * @file gpio_stream.h
+ * @brief Generación de formas de onda sobre un puerto GPIO a partir de datos en memoria.
+ *
+ * Este archivo define funciones que entregan a un canal DMA, disparado por un temporizador, una
+ * secuencia de palabras precalculadas que se escriben en los pines de un puerto a una frecuencia
+ * fija. Se utiliza para protocolos implementados por software, como WS2812 o pantallas LCD con bus
+ * paralelo, sin que el procesador intervenga en cada bit. El modo continuo utiliza un área de
+ * memoria dividida en dos mitades, de forma que la aplicación completa una mientras se transmite la
+ * otra.
+ *
+ * Solo puede haber una transferencia en curso a la vez. Mientras dura, los pines controlados no
+ * deben modificarse con otras funciones.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+/* No se definen macros en este archivo */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Función que completa un bloque de palabras de una transferencia continua.
+ *
+ * Se invoca desde la interrupción del canal DMA cada vez que se termina de transmitir un bloque,
+ * que puede entonces volver a escribirse con los datos siguientes de la forma de onda.
+ *
+ * @param words Bloque que se debe completar.
+ * @param count Cantidad de palabras del bloque.
+ * @param context Puntero provisto por la aplicación al iniciar la transferencia.
+ */
+typedef void (*gpio_stream_refill_t)(uint32_t * words, size_t count, void * context);
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Transmite una forma de onda por los pines de un puerto.
+ *
+ * En cada período se escribe una palabra en el puerto: los pines seleccionados por `mask` toman el
+ * valor del bit correspondiente y el resto no se modifica. La función retorna inmediatamente y la
+ * transferencia continúa en segundo plano; el área de memoria debe permanecer válida hasta que
+ * gpioPortStreamBusy() devuelva false.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Máscara con los pines que controla la forma de onda.
+ * @param words Palabras que se escriben en el puerto.
+ * @param count Cantidad de palabras.
+ * @param rate Cantidad de palabras por segundo.
+ *
+ * @return true si la transferencia se inició, false si ya hay otra en curso, si el puerto no
+ * existe o es virtual, si falta el área de memoria o si `count` o `rate` son cero.
+ */
+bool gpioPortStream(gpio_port_t port, uint32_t mask, const uint32_t * words, size_t count,
+                    uint32_t rate);
+
+/**
+ * @brief Transmite una forma de onda continua generada por bloques.
+ *
+ * El área de memoria contiene dos bloques de `count` palabras que se transmiten alternadamente.
+ * La función `refill` se invoca con cada bloque para completarlo: primero con ambos antes de
+ * comenzar y luego con cada uno a medida que termina de transmitirse.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Máscara con los pines que controla la forma de onda.
+ * @param buffer Área de memoria de `2 * count` palabras.
+ * @param count Cantidad de palabras de cada bloque.
+ * @param rate Cantidad de palabras por segundo.
+ * @param refill Función que completa cada bloque.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ *
+ * @return true si la transferencia se inició, false si ya hay otra en curso, si el puerto no
+ * existe o es virtual, si falta el área de memoria o si `count` o `rate` son cero.
+ */
+bool gpioPortStreamContinuous(gpio_port_t port, uint32_t mask, uint32_t * buffer, size_t count,
+                              uint32_t rate, gpio_stream_refill_t refill, void * context);
+
+/**
+ * @brief Detiene la transferencia en curso.
+ *
+ * Los pines conservan el estado de la última palabra transmitida, que pasa a ser el estado
+ * conocido por gpioGetOutputLatch() y por la omisión de escrituras redundantes.
+ */
+void gpioPortStreamStop(void);
+
+/**
+ * @brief Indica si hay una transferencia en curso.
+ *
+ * @return true si hay una transferencia en curso, false en caso contrario.
+ */
+bool gpioPortStreamBusy(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_STREAM_H */
@@ -0,0 +1,150 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_TIMER_H
+#define GPIO_TIMER_H
+
+/**
+ * @file gpio_timer.h
+ * @brief Acciones temporizadas sobre pines GPIO.
+ *
+ * Este archivo define un planificador que ejecuta pulsos, parpadeos y escrituras diferidas sobre
+ * objetos gpio_t a partir de un único temporizador de hardware. Las acciones se guardan en una
+ * rueda de temporización, por lo que agregar, cancelar y vencer una acción lleva un tiempo
+ * constante, y todas las acciones que vencen en la misma interrupción se combinan en una única
+ * escritura enmascarada por puerto.
+ *
+ * Las acciones se solicitan desde el lazo principal y se comunican a la interrupción del
+ * temporizador con colas sin bloqueos, por lo que ninguno de los dos contextos deshabilita
+ * interrupciones. Por ese mismo motivo las funciones de este archivo deben llamarse siempre desde
+ * un único contexto. Los tiempos se expresan en interrupciones del temporizador.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef GPIO_TIMER_MAX_ACTIONS
+#define GPIO_TIMER_MAX_ACTIONS 16 /**< Acciones pendientes, potencia de dos hasta 128. */
+#endif
+
+#ifndef GPIO_TIMER_SLOTS
+#define GPIO_TIMER_SLOTS 32 /**< Posiciones de la rueda, debe ser una potencia de dos. */
+#endif
+
+#define GPIO_ACTION_NONE 0 /**< Valor de gpio_action_t que no corresponde a ninguna acción. */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef gpio_action_t
+ * @brief Identificador de una acción temporizada.
+ *
+ * Incluye un número de generación, por lo que cancelar una acción que ya terminó no afecta a otra
+ * acción que reutilice sus recursos.
+ */
+typedef uint16_t gpio_action_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Inicia el planificador de acciones temporizadas.
+ *
+ * Se descartan las acciones pendientes de una ejecución anterior.
+ *
+ * @param timer Temporizador de hardware que utiliza el planificador.
+ * @param frequency Cantidad de interrupciones por segundo, que define la resolución de los tiempos.
+ */
+void gpioTimerStart(uint8_t timer, uint32_t frequency);
+
+/**
+ * @brief Detiene el planificador y descarta las acciones pendientes.
+ *
+ * Los pines conservan el último estado escrito.
+ */
+void gpioTimerStop(void);
+
+/**
+ * @brief Genera un pulso en alto en un pin.
+ *
+ * El pin se pone en alto inmediatamente y vuelve a bajo cuando transcurre el ancho indicado.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param width Duración del pulso en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioPulse(gpio_t gpio, uint32_t width);
+
+/**
+ * @brief Hace parpadear un pin hasta que se cancele la acción.
+ *
+ * El pin se pone en alto inmediatamente, permanece así durante el tiempo de encendido y luego
+ * alterna entre bajo y alto con los tiempos indicados.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param on Tiempo en alto en interrupciones del temporizador, al menos una.
+ * @param off Tiempo en bajo en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioBlink(gpio_t gpio, uint32_t on, uint32_t off);
+
+/**
+ * @brief Cambia el estado de un pin cuando transcurre un tiempo.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param state Estado que se escribe en el pin.
+ * @param delay Tiempo de espera en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioSetStateAfter(gpio_t gpio, bool state, uint32_t delay);
+
+/**
+ * @brief Cancela una acción pendiente.
+ *
+ * La cancelación se aplica en la siguiente interrupción del temporizador y el pin conserva el
+ * último estado escrito. Cancelar una acción que ya terminó no tiene efecto.
+ *
+ * @param action Acción que se desea cancelar.
+ * @return bool true si el pedido se registró, false si la cola de pedidos está llena.
+ */
+bool gpioCancel(gpio_action_t action);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_TIMER_H */
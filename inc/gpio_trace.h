@@ -0,0 +1,132 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef GPIO_TRACE_H
+#define GPIO_TRACE_H
+
+/**
+ * @file gpio_trace.h
+ * @brief Registro de la actividad de los GPIO en un flujo binario compacto.
+ *
+ * Este archivo define un registrador que guarda en una cola circular cada escritura de salidas,
+ * cada cambio de dirección y cada flanco de entrada atendido, junto con el instante en que ocurrió.
+ * Los registros se codifican como diferencias respecto del registro anterior, sin formatear texto
+ * en el destino, y la aplicación retira los bytes para enviarlos al anfitrión, donde la herramienta
+ * trace2vcd los convierte al formato VCD. Los puntos de registro solo se compilan si se define el
+ * símbolo USE_GPIO_TRACE.
+ *
+ * Cada registro comienza con un byte que contiene el tipo en los tres bits más significativos y el
+ * número de puerto en los cinco restantes, seguido de dos enteros de longitud variable de siete
+ * bits por byte, el menos significativo primero y con el bit más significativo indicando que el
+ * valor continúa: las cuentas transcurridas desde el registro anterior y el valor del puerto
+ * combinado con una o exclusiva con el último valor registrado del mismo tipo y puerto. El registro
+ * de sincronización solo contiene la frecuencia del contador y reinicia la referencia de tiempo y
+ * los últimos valores a cero, por lo que el registro siguiente contiene el tiempo absoluto.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef GPIO_TRACE_SIZE
+#define GPIO_TRACE_SIZE 1024 /**< Capacidad en bytes de la cola, debe ser una potencia de dos. */
+#endif
+
+#define GPIO_TRACE_OUTPUT    0 /**< Registro del estado de las salidas de un puerto. */
+#define GPIO_TRACE_DIRECTION 1 /**< Registro de la dirección de los pines de un puerto. */
+#define GPIO_TRACE_INPUT     2 /**< Registro del estado de las entradas al atender un flanco. */
+#define GPIO_TRACE_KINDS     3 /**< Cantidad de tipos de registro con valor. */
+#define GPIO_TRACE_SYNC      7 /**< Registro de sincronización del flujo. */
+
+#define GPIO_TRACE_KIND(header) ((header) >> 5)   /**< Tipo de registro a partir de su cabecera. */
+#define GPIO_TRACE_PORT(header) ((header) & 0x1F) /**< Puerto a partir de la cabecera. */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Habilita o deshabilita el registro de actividad.
+ *
+ * Al habilitarlo el próximo registro escrito en la cola es uno de sincronización, de manera que el
+ * flujo puede decodificarse desde ese punto. Mientras está deshabilitado cada punto de registro
+ * solo consulta una variable.
+ *
+ * @param enable true para registrar la actividad, false para dejar de hacerlo.
+ */
+void gpioTraceEnable(bool enable);
+
+/**
+ * @brief Agrega un registro a la cola.
+ *
+ * La función es invocada por la biblioteca en los mismos puntos en que se cuentan los accesos a la
+ * HAL y puede ejecutarse desde interrupciones, ya que la escritura se protege con una sección
+ * crítica de unas pocas instrucciones. No protege contra escrituras simultáneas desde otro núcleo.
+ * Si la cola no tiene espacio el registro se descarta, se incrementa el contador de registros
+ * perdidos y el siguiente registro escrito es uno de sincronización.
+ *
+ * @param kind Tipo de registro, GPIO_TRACE_OUTPUT, GPIO_TRACE_DIRECTION o GPIO_TRACE_INPUT.
+ * @param port Número de puerto.
+ * @param value Estado de los pines del puerto.
+ */
+void gpioTraceRecord(uint8_t kind, uint8_t port, uint32_t value);
+
+/**
+ * @brief Retira de la cola los bytes registrados.
+ *
+ * Debe invocarse siempre desde el mismo contexto, habitualmente el lazo principal. Los bytes
+ * obtenidos en llamadas sucesivas forman un flujo continuo.
+ *
+ * @param buffer Arreglo donde se copian los bytes.
+ * @param size Cantidad máxima de bytes que se pueden copiar en el arreglo.
+ *
+ * @return La cantidad de bytes copiados.
+ */
+size_t gpioTraceRead(uint8_t * buffer, size_t size);
+
+/**
+ * @brief Obtiene la cantidad de registros descartados porque la cola estaba llena.
+ *
+ * @return La cantidad de registros perdidos desde el arranque del sistema.
+ */
+uint32_t gpioTraceDropped(void);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GPIO_TRACE_H */
@@ -36,6 +36,11 @@ SPDX-License-Identifier: MIT
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+#ifdef HAL_LPC43XX
+#include "hal_lpc43xx.h"
+#endif
 
 /* === Cabecera para C++ ====================================================================== */
 
@@ -45,11 +50,90 @@ extern "C" {
 
 /* === Definición de macros públicas ========================================================= */
 
-/* No se definen macros en este archivo */
+#ifndef HAL_GPIO_PORTS
+#define HAL_GPIO_PORTS 8 /**< Cantidad de puertos GPIO disponibles en el microcontrolador. */
+#endif
+
+#define HAL_GPIO_PORT_WIDTH 32 /**< Cantidad de bits de cada puerto GPIO. */
+
+#ifndef HAL_TIMER_COUNT
+#define HAL_TIMER_COUNT 4 /**< Cantidad de temporizadores de hardware disponibles. */
+#endif
+
+/**
+ * @brief Indica si la implementación de la HAL expone los registros de GPIO.
+ *
+ * Una implementación que permite el acceso directo a sus registros define esta macro en 1 junto
+ * con `HAL_GPIO_SET_REGISTER(port)`, `HAL_GPIO_CLEAR_REGISTER(port)`,
+ * `HAL_GPIO_TOGGLE_REGISTER(port)` y `HAL_GPIO_PIN_REGISTER(port)`, que se expanden al registro
+ * correspondiente del puerto. Cuando vale 0 los accesos se realizan a través de las funciones de
+ * este archivo.
+ */
+#ifndef HAL_GPIO_DIRECT_ACCESS
+#define HAL_GPIO_DIRECT_ACCESS 0
+#endif
+
+/**
+ * @def HAL_GPIO_PIN_WORD_REGISTER(port, bit)
+ * @brief Registro cuya escritura fija el nivel de un único pin.
+ *
+ * Una implementación de la HAL puede definir esta macro para que se expanda al registro de palabra
+ * del pin o a la dirección de su alias en la región de bit-band, donde escribir cero pone el pin
+ * en bajo y escribir otro valor lo pone en alto. La biblioteca la utiliza en el modo
+ * `USE_ATOMIC_GPIO` para escribir cada pin con un único almacenamiento. Si no se define, ese modo
+ * utiliza los registros de set y clear del puerto o, sin acceso directo, hal_gpio_set_output(),
+ * que debe ser atómica respecto de los demás pines del puerto.
+ */
 
 /* === Declaraciones de tipos de datos públicos ============================================ */
 
-/* No se definen tipos de datos en este archivo */
+/**
+ * @brief Flancos de un pin GPIO que pueden generar una interrupción.
+ */
+typedef enum hal_gpio_edge_e {
+    HAL_GPIO_EDGE_NONE = 0,    /**< El pin no genera interrupciones. */
+    HAL_GPIO_EDGE_RISING = 1,  /**< Interrupción en el flanco ascendente. */
+    HAL_GPIO_EDGE_FALLING = 2, /**< Interrupción en el flanco descendente. */
+    HAL_GPIO_EDGE_BOTH = 3,    /**< Interrupción en ambos flancos. */
+} hal_gpio_edge_t;
+
+/**
+ * @brief Función que atiende las interrupciones de los pines de un puerto.
+ *
+ * La HAL la invoca desde la rutina de interrupción con todos los pines del puerto que tienen una
+ * interrupción pendiente, después de haber borrado esas banderas.
+ *
+ * @param port Puerto cuyos pines generaron la interrupción.
+ * @param pending Máscara con los pines que tienen una interrupción pendiente.
+ * @param levels Estado de los pines del puerto en el momento de la interrupción.
+ */
+typedef void (*hal_gpio_irq_handler_t)(uint8_t port, uint32_t pending, uint32_t levels);
+
+/**
+ * @brief Función que atiende la interrupción de un temporizador.
+ *
+ * La HAL la invoca desde la rutina de interrupción del temporizador. El valor de retorno indica
+ * cuántas cuentas después de esta interrupción debe producirse la siguiente, medidas desde el
+ * instante programado y no desde el momento en que se atiende, por lo que los retardos en la
+ * atención no se acumulan. Un valor cero detiene el temporizador.
+ *
+ * @param context Puntero provisto por la aplicación al iniciar el temporizador.
+ *
+ * @return Cantidad de cuentas hasta la próxima interrupción o cero para detener el temporizador.
+ */
+typedef uint32_t (*hal_timer_handler_t)(void * context);
+
+/**
+ * @brief Función que se invoca cuando la transferencia DMA hacia un puerto completa un bloque.
+ *
+ * En una transferencia circular se invoca al terminar cada mitad del área de memoria, indicando
+ * cuál de ellas puede volver a escribirse. En una transferencia simple se invoca una única vez, al
+ * terminar, con `half` en cero.
+ *
+ * @param half Mitad del área de memoria que se terminó de transferir, 0 o 1.
+ * @param context Puntero provisto por la aplicación al iniciar la transferencia.
+ */
+typedef void (*hal_gpio_stream_handler_t)(uint8_t half, void * context);
 
 /* === Declaraciones de variables públicas =================================================== */
 
@@ -69,6 +153,19 @@ extern "C" {
  */
 void hal_gpio_set_direction(uint8_t port, uint8_t bit, bool output);
 
+/**
+ * @brief Configura la dirección de varios pines de un mismo puerto en una única operación.
+ *
+ * Esta función actualiza el registro de dirección del puerto con una sola escritura. Los pines
+ * seleccionados por `mask` se configuran como salida si el bit correspondiente de `outputs` está
+ * en uno y como entrada en caso contrario; el resto de los pines no se modifica.
+ *
+ * @param port El puerto del microcontrolador que se desea configurar.
+ * @param mask Máscara con los pines cuya dirección se desea configurar.
+ * @param outputs Máscara con los pines que deben quedar configurados como salida.
+ */
+void hal_gpio_set_port_direction(uint8_t port, uint32_t mask, uint32_t outputs);
+
 /**
  * @brief Establece el estado de un pin GPIO configurado como salida.
  *
@@ -93,6 +190,159 @@ void hal_gpio_set_output(uint8_t port, uint8_t bit, bool active);
  */
 bool hal_gpio_get_input(uint8_t port, uint8_t bit);
 
+/**
+ * @brief Lee el estado de todos los pines de un puerto en una única operación.
+ *
+ * Esta función lee una sola vez el registro de entrada del puerto, por lo que todos los bits
+ * corresponden al mismo instante.
+ *
+ * @param port El puerto del microcontrolador que se desea leer.
+ *
+ * @return El estado de los pines del puerto, un bit por cada pin.
+ */
+uint32_t hal_gpio_get_port(uint8_t port);
+
+/**
+ * @brief Configura los flancos de un pin GPIO que generan una interrupción.
+ *
+ * @param port El puerto del microcontrolador al que está conectado el pin.
+ * @param bit El bit dentro del puerto que se desea configurar.
+ * @param edge Flancos que deben generar una interrupción, HAL_GPIO_EDGE_NONE la deshabilita.
+ *
+ * @return true si la interrupción quedó configurada, false si la plataforma no tiene recursos para
+ * observar el pin.
+ */
+bool hal_gpio_set_edge(uint8_t port, uint8_t bit, hal_gpio_edge_t edge);
+
+/**
+ * @brief Registra la función que atiende las interrupciones de los pines GPIO.
+ *
+ * @param handler Función invocada con la máscara de pines pendientes de cada puerto.
+ */
+void hal_gpio_set_irq_handler(hal_gpio_irq_handler_t handler);
+
+/**
+ * @brief Modifica varios pines de un mismo puerto en una única operación.
+ *
+ * Esta función escribe todos los bits indicados en una sola transacción sobre el puerto, de forma
+ * que cambian en el mismo instante. Los bits que no figuran en ninguna de las dos máscaras
+ * conservan su valor. Si un bit figura en ambas máscaras prevalece `set`. En el LPC43xx, mientras
+ * una transferencia de hal_gpio_stream_start() utiliza el mismo puerto, primero se escriben los
+ * bits en bajo y luego los bits en alto.
+ *
+ * @param port El puerto del microcontrolador que se desea modificar.
+ * @param set Máscara con los bits que deben pasar a estado alto.
+ * @param clear Máscara con los bits que deben pasar a estado bajo.
+ */
+void hal_gpio_set_port_mask(uint8_t port, uint32_t set, uint32_t clear);
+
+/**
+ * @brief Invierte el estado de varios pines de un mismo puerto en una única operación.
+ *
+ * @param port El puerto del microcontrolador que se desea modificar.
+ * @param mask Máscara con los bits que deben cambiar de estado.
+ */
+void hal_gpio_toggle_port_mask(uint8_t port, uint32_t mask);
+
+/**
+ * @brief Inicia una transferencia DMA desde memoria hacia los pines de un puerto.
+ *
+ * Un temporizador dispara la escritura de una palabra del área de memoria por cada período, en el
+ * registro enmascarado del puerto: los pines seleccionados por `mask` toman el valor del bit
+ * correspondiente de la palabra y el resto no se modifica. El procesador no interviene durante la
+ * transferencia.
+ *
+ * @param port El puerto del microcontrolador que se desea escribir.
+ * @param mask Máscara con los pines que controla la transferencia.
+ * @param words Área de memoria con las palabras que se escriben en el puerto.
+ * @param count Cantidad total de palabras del área de memoria.
+ * @param rate Cantidad de palabras por segundo.
+ * @param circular Indica si al terminar el área de memoria la transferencia vuelve a comenzar.
+ * @param handler Función que se invoca al completar cada mitad o al terminar, puede ser NULL.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ *
+ * @return true si la transferencia se inició, false si ya hay otra transferencia en curso.
+ */
+bool hal_gpio_stream_start(uint8_t port, uint32_t mask, const uint32_t * words, size_t count,
+                           uint32_t rate, bool circular, hal_gpio_stream_handler_t handler,
+                           void * context);
+
+/**
+ * @brief Detiene la transferencia DMA en curso.
+ */
+void hal_gpio_stream_stop(void);
+
+/**
+ * @brief Inicia un temporizador de hardware.
+ *
+ * @param timer Número del temporizador, menor que HAL_TIMER_COUNT.
+ * @param frequency Frecuencia de cuenta del temporizador en Hz.
+ * @param ticks Cantidad de cuentas hasta la primera interrupción.
+ * @param handler Función que atiende cada interrupción y programa la siguiente.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ */
+void hal_timer_start(uint8_t timer, uint32_t frequency, uint32_t ticks, hal_timer_handler_t handler,
+                     void * context);
+
+/**
+ * @brief Detiene un temporizador de hardware.
+ *
+ * @param timer Número del temporizador, menor que HAL_TIMER_COUNT.
+ */
+void hal_timer_stop(uint8_t timer);
+
+/**
+ * @brief Lee el contador de tiempo libre de la plataforma.
+ *
+ * El contador avanza de manera continua desde el arranque del sistema y desborda al alcanzar su
+ * valor máximo, por lo que las diferencias entre dos lecturas deben calcularse en aritmética sin
+ * signo. Se utiliza para marcar el instante de los eventos.
+ *
+ * @return El valor actual del contador.
+ */
+uint32_t hal_timestamp(void);
+
+/**
+ * @brief Obtiene la frecuencia del contador de tiempo libre de la plataforma.
+ *
+ * @return La cantidad de cuentas por segundo de hal_timestamp().
+ */
+uint32_t hal_timestamp_frequency(void);
+
+/**
+ * @brief Detiene el procesador hasta la próxima interrupción.
+ *
+ * Si la plataforma no tiene un modo de bajo consumo la función retorna de inmediato.
+ */
+void hal_cpu_sleep(void);
+
+/**
+ * @brief Obtiene el número del núcleo que ejecuta el código.
+ *
+ * En las plataformas con un único núcleo la función siempre retorna cero.
+ *
+ * @return El número del núcleo, a partir de cero.
+ */
+uint8_t hal_cpu_id(void);
+
+/**
+ * @brief Deshabilita las interrupciones del núcleo que ejecuta el código.
+ *
+ * Se utiliza para secciones críticas de unas pocas instrucciones que pueden ser interrumpidas por
+ * otro productor del mismo núcleo. Las secciones pueden anidarse si cada una restaura el estado que
+ * obtuvo con hal_irq_unlock().
+ *
+ * @return El estado de las interrupciones antes de deshabilitarlas.
+ */
+uint32_t hal_irq_lock(void);
+
+/**
+ * @brief Restaura el estado de las interrupciones obtenido con hal_irq_lock().
+ *
+ * @param state Estado de las interrupciones que se desea restaurar.
+ */
+void hal_irq_unlock(uint32_t state);
+
 /* === Fin de la documentación ============================================================= */
 
 #ifdef __cplusplus
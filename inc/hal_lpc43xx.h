@@ -0,0 +1,172 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_LPC43XX_H
+#define HAL_LPC43XX_H
+
+/**
+ * @file hal_lpc43xx.h
+ * @brief Mapa de registros de los periféricos de la familia LPC43xx que utiliza la HAL.
+ *
+ * Este archivo describe, con estructuras superpuestas a las direcciones de los periféricos, los
+ * registros del controlador GPIO, de las interrupciones de pines, de los temporizadores y del
+ * controlador DMA que utiliza la implementación de la HAL para el núcleo Cortex-M4 de la familia
+ * LPC43xx. Además habilita el acceso directo a los registros de GPIO desde la biblioteca. Se
+ * incluye desde hal.h cuando se compila con `make HAL=lpc43xx`, que define `HAL_LPC43XX`.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef HAL_CPU_FREQUENCY
+#define HAL_CPU_FREQUENCY 204000000 /**< Frecuencia del núcleo y de los temporizadores, en Hz. */
+#endif
+
+#define LPC43XX_GPIO    ((lpc43xx_gpio_t *)0x400F4000)    /**< Controlador GPIO. */
+#define LPC43XX_PINT    ((lpc43xx_pint_t *)0x40087000)    /**< Interrupciones de pines. */
+#define LPC43XX_PINTSEL ((volatile uint32_t *)0x40086E00) /**< Selección de pines del PINT. */
+#define LPC43XX_DMAMUX  (*(volatile uint32_t *)0x4004311C) /**< Fuentes de pedidos de DMA. */
+#define LPC43XX_GPDMA   ((lpc43xx_gpdma_t *)0x40002000)   /**< Controlador DMA. */
+
+#define LPC43XX_TIMER0 ((lpc43xx_timer_t *)0x40084000) /**< Temporizador 0. */
+#define LPC43XX_TIMER1 ((lpc43xx_timer_t *)0x40085000) /**< Temporizador 1. */
+#define LPC43XX_TIMER2 ((lpc43xx_timer_t *)0x400C3000) /**< Temporizador 2. */
+#define LPC43XX_TIMER3 ((lpc43xx_timer_t *)0x400C4000) /**< Temporizador 3. */
+
+#define LPC43XX_PINT_CHANNELS 8 /**< Cantidad de canales de interrupción de pines. */
+#define LPC43XX_DMA_CHANNELS  8 /**< Cantidad de canales del controlador DMA. */
+
+/** La HAL de esta familia permite el acceso directo a los registros de GPIO. */
+#define HAL_GPIO_DIRECT_ACCESS 1
+
+/** Registro que pone en alto los pines escritos en uno. */
+#define HAL_GPIO_SET_REGISTER(port) (LPC43XX_GPIO->SET[port])
+
+/** Registro que pone en bajo los pines escritos en uno. */
+#define HAL_GPIO_CLEAR_REGISTER(port) (LPC43XX_GPIO->CLR[port])
+
+/** Registro que invierte los pines escritos en uno. */
+#define HAL_GPIO_TOGGLE_REGISTER(port) (LPC43XX_GPIO->NOT[port])
+
+/** Registro con el nivel de todos los pines del puerto. */
+#define HAL_GPIO_PIN_REGISTER(port) (LPC43XX_GPIO->PIN[port])
+
+/** Registro de palabra de un pin, que fija su nivel con un único almacenamiento. */
+#define HAL_GPIO_PIN_WORD_REGISTER(port, bit) (LPC43XX_GPIO->W[port][bit])
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Registros del controlador GPIO.
+ *
+ * Cada puerto ocupa una posición de los arreglos de 32 palabras, y los registros de byte y de
+ * palabra ofrecen un registro propio para cada pin.
+ */
+typedef struct lpc43xx_gpio_s {
+    volatile uint8_t B[8][32];          /**< Nivel de cada pin, un byte por pin. */
+    uint8_t reserved0[0x1000 - 0x100];  /**< Espacio sin registros. */
+    volatile uint32_t W[8][32];         /**< Nivel de cada pin, una palabra por pin. */
+    uint8_t reserved1[0x2000 - 0x1400]; /**< Espacio sin registros. */
+    volatile uint32_t DIR[32];          /**< Dirección de los pines, en uno las salidas. */
+    volatile uint32_t MASK[32];         /**< Pines excluidos de los accesos a MPIN. */
+    volatile uint32_t PIN[32];          /**< Nivel de los pines del puerto. */
+    volatile uint32_t MPIN[32];         /**< Nivel de los pines no excluidos por MASK. */
+    volatile uint32_t SET[32];          /**< Pone en alto los pines escritos en uno. */
+    volatile uint32_t CLR[32];          /**< Pone en bajo los pines escritos en uno. */
+    volatile uint32_t NOT[32];          /**< Invierte los pines escritos en uno. */
+} lpc43xx_gpio_t;
+
+/**
+ * @brief Registros del bloque de interrupciones de pines.
+ */
+typedef struct lpc43xx_pint_s {
+    volatile uint32_t ISEL;  /**< Modo de cada canal, en cero por flanco. */
+    volatile uint32_t IENR;  /**< Canales habilitados en el flanco ascendente. */
+    volatile uint32_t SIENR; /**< Habilita el flanco ascendente de los canales escritos en uno. */
+    volatile uint32_t CIENR; /**< Deshabilita el flanco ascendente de los canales escritos. */
+    volatile uint32_t IENF;  /**< Canales habilitados en el flanco descendente. */
+    volatile uint32_t SIENF; /**< Habilita el flanco descendente de los canales escritos en uno. */
+    volatile uint32_t CIENF; /**< Deshabilita el flanco descendente de los canales escritos. */
+    volatile uint32_t RISE;  /**< Flancos ascendentes detectados. */
+    volatile uint32_t FALL;  /**< Flancos descendentes detectados. */
+    volatile uint32_t IST;   /**< Interrupciones pendientes, se borran escribiendo uno. */
+} lpc43xx_pint_t;
+
+/**
+ * @brief Registros de un temporizador.
+ */
+typedef struct lpc43xx_timer_s {
+    volatile uint32_t IR;    /**< Interrupciones pendientes, se borran escribiendo uno. */
+    volatile uint32_t TCR;   /**< Control del contador. */
+    volatile uint32_t TC;    /**< Contador. */
+    volatile uint32_t PR;    /**< Divisor de la frecuencia de cuenta. */
+    volatile uint32_t PC;    /**< Contador del divisor. */
+    volatile uint32_t MCR;   /**< Acciones en cada coincidencia. */
+    volatile uint32_t MR[4]; /**< Valores de coincidencia. */
+} lpc43xx_timer_t;
+
+/**
+ * @brief Registros de un canal del controlador DMA.
+ */
+typedef struct lpc43xx_gpdma_channel_s {
+    volatile uint32_t SRCADDR;  /**< Dirección de origen. */
+    volatile uint32_t DESTADDR; /**< Dirección de destino. */
+    volatile uint32_t LLI;      /**< Próximo bloque de la lista de transferencias. */
+    volatile uint32_t CONTROL;  /**< Tamaño y formato del bloque. */
+    volatile uint32_t CONFIG;   /**< Configuración del canal. */
+    uint32_t reserved[3];       /**< Espacio sin registros. */
+} lpc43xx_gpdma_channel_t;
+
+/**
+ * @brief Registros del controlador DMA.
+ */
+typedef struct lpc43xx_gpdma_s {
+    volatile uint32_t INTSTAT;                        /**< Canales con interrupciones pendientes. */
+    volatile uint32_t INTTCSTAT;                      /**< Canales que completaron un bloque. */
+    volatile uint32_t INTTCCLEAR;                     /**< Borra los bloques completados. */
+    volatile uint32_t INTERRSTAT;                     /**< Canales con errores. */
+    volatile uint32_t INTERRCLR;                      /**< Borra las interrupciones de error. */
+    uint32_t reserved0[7];                            /**< Registros no utilizados. */
+    volatile uint32_t CONFIG;                         /**< Configuración del controlador. */
+    uint32_t reserved1[51];                           /**< Registros no utilizados. */
+    lpc43xx_gpdma_channel_t CH[LPC43XX_DMA_CHANNELS]; /**< Canales del controlador. */
+} lpc43xx_gpdma_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_LPC43XX_H */
@@ -0,0 +1,168 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_SIM_H
+#define HAL_SIM_H
+
+/**
+ * @file hal_sim.h
+ * @brief Funciones de control de la HAL simulada.
+ *
+ * Este archivo define las funciones adicionales de la implementación simulada de la HAL, que
+ * permiten a un programa de prueba aplicar niveles a las entradas, observar las salidas, avanzar
+ * el tiempo virtual y registrar cada acceso a los registros simulados. Solo está disponible cuando
+ * se compila con `make HAL=sim`.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @brief Tipos de acceso a los registros simulados.
+ */
+typedef enum hal_sim_access_e {
+    HAL_SIM_ACCESS_DIRECTION, /**< Cambio de la dirección de los pines. */
+    HAL_SIM_ACCESS_WRITE,     /**< Escritura de las salidas desde el programa. */
+    HAL_SIM_ACCESS_READ,      /**< Lectura del nivel de los pines. */
+    HAL_SIM_ACCESS_STREAM,    /**< Escritura de las salidas desde la transferencia DMA. */
+} hal_sim_access_t;
+
+/**
+ * @brief Descripción de un acceso a los registros simulados.
+ */
+typedef struct hal_sim_event_s {
+    uint64_t time;         /**< Instante del acceso, en nanosegundos. */
+    hal_sim_access_t kind; /**< Tipo de acceso. */
+    uint8_t port;          /**< Puerto accedido. */
+    uint32_t mask;         /**< Pines involucrados. */
+    uint32_t value;        /**< Valor del registro después de la escritura o valor leído. */
+} hal_sim_event_t;
+
+/**
+ * @brief Función que recibe cada acceso a los registros simulados.
+ *
+ * @param event Descripción del acceso, válida solo durante la llamada.
+ */
+typedef void (*hal_sim_trace_t)(const hal_sim_event_t * event);
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Restablece los registros, los temporizadores y el tiempo virtual a su estado inicial.
+ */
+void hal_sim_reset(void);
+
+/**
+ * @brief Aplica niveles externos a los pines de un puerto.
+ *
+ * Los pines configurados como entrada toman el nivel indicado y, si cambian, generan las
+ * interrupciones de flanco configuradas antes de que la función retorne.
+ *
+ * @param port Puerto cuyos pines se modifican.
+ * @param mask Pines que se modifican.
+ * @param value Niveles aplicados a los pines indicados en `mask`.
+ */
+void hal_sim_set_input(uint8_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Obtiene el valor del registro de salida de un puerto.
+ *
+ * @param port Puerto consultado.
+ * @return uint32_t El valor escrito en las salidas, incluidos los pines configurados como entrada.
+ */
+uint32_t hal_sim_get_output(uint8_t port);
+
+/**
+ * @brief Obtiene la dirección de los pines de un puerto.
+ *
+ * @param port Puerto consultado.
+ * @return uint32_t Un bit en uno por cada pin configurado como salida.
+ */
+uint32_t hal_sim_get_direction(uint8_t port);
+
+/**
+ * @brief Obtiene el nivel actual de los pines de un puerto.
+ *
+ * @param port Puerto consultado.
+ * @return uint32_t El valor de las salidas en los pines de salida y el nivel aplicado en el resto.
+ */
+uint32_t hal_sim_get_level(uint8_t port);
+
+/**
+ * @brief Avanza el tiempo virtual.
+ *
+ * Atiende en orden cronológico las interrupciones de los temporizadores y las palabras de la
+ * transferencia DMA que vencen dentro del intervalo.
+ *
+ * @param nanoseconds Duración del intervalo, en nanosegundos.
+ */
+void hal_sim_advance(uint64_t nanoseconds);
+
+/**
+ * @brief Obtiene el instante actual del tiempo virtual.
+ *
+ * @return uint64_t Nanosegundos transcurridos desde el último restablecimiento.
+ */
+uint64_t hal_sim_now(void);
+
+/**
+ * @brief Configura la función que recibe cada acceso a los registros simulados.
+ *
+ * @param function Función que recibe los accesos o NULL para dejar de registrarlos.
+ */
+void hal_sim_set_trace(hal_sim_trace_t function);
+
+/**
+ * @brief Obtiene la cantidad de accesos a los registros simulados.
+ *
+ * @return uint32_t Accesos desde el último restablecimiento.
+ */
+uint32_t hal_sim_accesses(void);
+
+/**
+ * @brief Indica el núcleo que devuelve hal_cpu_id() a partir de este momento.
+ *
+ * Permite ejecutar en la computadora el código de cada núcleo de una plataforma con varios.
+ *
+ * @param id Número del núcleo simulado.
+ */
+void hal_sim_set_cpu(uint8_t id);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_SIM_H */
@@ -0,0 +1,101 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HC595_H
+#define HC595_H
+
+/**
+ * @file hc595.h
+ * @brief Cadenas de registros de desplazamiento 74HC595 como puertos virtuales.
+ *
+ * Este archivo define un controlador de puertos virtuales para una cadena de registros 74HC595.
+ * Cada puerto virtual agrupa las 32 salidas de cuatro registros consecutivos, por lo que una
+ * cadena de 64 salidas ocupa dos puertos y se actualiza con un único desplazamiento en cada
+ * gpioFlush(). El registro más cercano al microcontrolador maneja los bits 0 a 7 del primer
+ * puerto y la salida Qn de cada registro corresponde al bit n de su byte.
+ *
+ * La transferencia la realiza la aplicación, normalmente con un periférico SPI, enviando los bytes
+ * en el orden recibido con el bit más significativo primero y generando el pulso de la señal de
+ * carga al terminar.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gpio_backend.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef HC595_MAX_CHIPS
+#define HC595_MAX_CHIPS 16 /**< Número máximo de registros de cada cadena. */
+#endif
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef hc595_t
+ * @brief Tipo de dato para representar una cadena de registros 74HC595.
+ */
+typedef struct hc595_s * hc595_t;
+
+/**
+ * @brief Función de la aplicación que desplaza los bytes hacia la cadena y carga las salidas.
+ *
+ * @param context Puntero provisto por la aplicación al crear la cadena.
+ * @param data Bytes que se desplazan, el primero corresponde al registro más lejano.
+ * @param size Cantidad de bytes, uno por registro.
+ */
+typedef void (*hc595_transfer_t)(void * context, const uint8_t * data, size_t size);
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea una cadena de registros 74HC595 y la asocia a puertos virtuales.
+ *
+ * La cadena ocupa un puerto virtual por cada cuatro registros a partir del indicado. Los pines se
+ * crean con gpioCreate() sobre esos puertos y deben configurarse como salida.
+ *
+ * @param port Primer puerto virtual, obtenido con GPIO_VIRTUAL_PORT().
+ * @param chips Cantidad de registros de la cadena, como máximo HC595_MAX_CHIPS.
+ * @param transfer Función que realiza el desplazamiento y la carga.
+ * @param context Puntero que se entrega a la función de transferencia.
+ * @return hc595_t Cadena creada o NULL si no hay recursos o los puertos no están disponibles.
+ */
+hc595_t hc595Create(gpio_port_t port, uint8_t chips, hc595_transfer_t transfer, void * context);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HC595_H */
@@ -0,0 +1,141 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+/**
+ * @file keypad.h
+ * @brief Teclado matricial con filtro antirrebote y reposo con despertar por interrupción.
+ *
+ * Este archivo define un teclado formado por filas, que se manejan como salidas, y columnas, que
+ * se leen como entradas. Las columnas necesitan resistencias de pull-up externas, ya que la
+ * biblioteca no configura las resistencias internas de los pines. Cada barrido pone en bajo una
+ * fila por vez con una escritura por puerto y lee todas las columnas con una lectura por puerto.
+ * Las teclas se numeran fila por fila: la tecla de la fila r y la columna c tiene el número
+ * `r * columnas + c`, que es también su bit en las máscaras de teclas.
+ *
+ * Cuando no hay teclas presionadas el teclado queda en reposo: todas las filas quedan en bajo y se
+ * habilita la interrupción de flanco descendente de las columnas, de manera que keypadScan() no
+ * accede al hardware hasta que se presiona una tecla y la aplicación puede dormir con
+ * keypadSleep().
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#define KEYPAD_MAX_ROWS    8 /**< Máxima cantidad de filas de un teclado. */
+#define KEYPAD_MAX_COLUMNS 8 /**< Máxima cantidad de columnas de un teclado. */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef keypad_t
+ * @brief Tipo de dato para representar un teclado matricial.
+ */
+typedef struct keypad_s * keypad_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un teclado matricial.
+ *
+ * Las filas se configuran como salidas en alto y las columnas como entradas.
+ * Los parámetros no son válidos si algún objeto es NULL o si un mismo pin aparece más de una
+ * vez entre las filas y las columnas.
+ *
+ * @param rows Objetos GPIO de las filas.
+ * @param rows_count Cantidad de filas, entre 1 y `KEYPAD_MAX_ROWS`.
+ * @param columns Objetos GPIO de las columnas.
+ * @param columns_count Cantidad de columnas, entre 1 y `KEYPAD_MAX_COLUMNS`.
+ * @param count Cantidad de barridos consecutivos necesarios para aceptar un cambio de una tecla.
+ *
+ * @return El teclado creado o NULL si los parámetros no son válidos o no quedan recursos.
+ */
+keypad_t keypadCreate(const gpio_t * rows, uint8_t rows_count, const gpio_t * columns,
+                      uint8_t columns_count, uint8_t count);
+
+/**
+ * @brief Barre el teclado y actualiza el estado filtrado de las teclas.
+ *
+ * Debe llamarse periódicamente, por ejemplo desde la interrupción de un temporizador. Cada llamada
+ * lee las columnas de la fila seleccionada en la llamada anterior y selecciona la siguiente, de
+ * forma que las columnas tienen un período completo para estabilizarse; un barrido de todas las
+ * filas requiere tantas llamadas como filas, más una al salir del reposo. En reposo retorna de
+ * inmediato sin acceder al hardware.
+ *
+ * @param keypad Teclado que se desea barrer.
+ *
+ * @return Una máscara con las teclas cuyo estado filtrado cambió, cero mientras el barrido no se
+ * completa.
+ */
+uint64_t keypadScan(keypad_t keypad);
+
+/**
+ * @brief Obtiene las teclas presionadas.
+ *
+ * @param keypad Teclado consultado.
+ *
+ * @return Una máscara con un bit en uno por cada tecla presionada, según el filtro.
+ */
+uint64_t keypadGetKeys(keypad_t keypad);
+
+/**
+ * @brief Indica si el teclado está en reposo esperando una tecla.
+ *
+ * @param keypad Teclado consultado.
+ *
+ * @return true si no hay teclas presionadas y el teclado espera la interrupción de una columna.
+ */
+bool keypadIdle(keypad_t keypad);
+
+/**
+ * @brief Detiene el procesador mientras el teclado está en reposo.
+ *
+ * Retorna cuando se produce cualquier interrupción, o de inmediato si el teclado no está en
+ * reposo.
+ *
+ * @param keypad Teclado que se espera.
+ */
+void keypadSleep(keypad_t keypad);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEYPAD_H */
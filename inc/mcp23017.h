@@ -0,0 +1,109 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef MCP23017_H
+#define MCP23017_H
+
+/**
+ * @file mcp23017.h
+ * @brief Expansores I2C MCP23017 como puertos virtuales.
+ *
+ * Este archivo define un controlador de puertos virtuales para el expansor MCP23017. Cada expansor
+ * ocupa un puerto virtual: los bits 0 a 7 corresponden a GPA0 a GPA7 y los bits 8 a 15 a GPB0 a
+ * GPB7. En cada gpioFlush() las salidas de los 16 pines se escriben con una única transacción y,
+ * si cambió, la dirección con otra.
+ *
+ * Las transacciones las realiza la aplicación con su controlador I2C. Se utiliza la configuración
+ * de fábrica del expansor, con los registros de los dos puertos intercalados y dirección de
+ * registro autoincremental.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gpio_backend.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef mcp23017_t
+ * @brief Tipo de dato para representar un expansor MCP23017.
+ */
+typedef struct mcp23017_s * mcp23017_t;
+
+/**
+ * @brief Función de la aplicación que escribe bytes en un dispositivo I2C.
+ *
+ * @param context Puntero provisto por la aplicación al crear el expansor.
+ * @param address Dirección de 7 bits del dispositivo.
+ * @param data Bytes que se escriben, el primero es la dirección del registro.
+ * @param size Cantidad de bytes.
+ */
+typedef void (*mcp23017_write_t)(void * context, uint8_t address, const uint8_t * data,
+                                 size_t size);
+
+/**
+ * @brief Función de la aplicación que lee registros consecutivos de un dispositivo I2C.
+ *
+ * @param context Puntero provisto por la aplicación al crear el expansor.
+ * @param address Dirección de 7 bits del dispositivo.
+ * @param reg Dirección del primer registro.
+ * @param data Arreglo donde se copian los bytes leídos.
+ * @param size Cantidad de bytes.
+ */
+typedef void (*mcp23017_read_t)(void * context, uint8_t address, uint8_t reg, uint8_t * data,
+                                size_t size);
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un expansor MCP23017 y lo asocia a un puerto virtual.
+ *
+ * @param port Puerto virtual del expansor, obtenido con GPIO_VIRTUAL_PORT().
+ * @param address Dirección de 7 bits del expansor, entre 0x20 y 0x27.
+ * @param write Función que escribe en el bus I2C.
+ * @param read Función que lee del bus I2C o NULL si los pines solo se usan como salida.
+ * @param context Puntero que se entrega a las funciones del bus.
+ * @return mcp23017_t Expansor creado o NULL si no hay recursos o el puerto no está disponible.
+ */
+mcp23017_t mcp23017Create(gpio_port_t port, uint8_t address, mcp23017_write_t write,
+                          mcp23017_read_t read, void * context);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MCP23017_H */
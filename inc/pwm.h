@@ -0,0 +1,114 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef PWM_H
+#define PWM_H
+
+/**
+ * @file pwm.h
+ * @brief Generador de señales PWM por software sobre pines GPIO.
+ *
+ * Este archivo define un generador que maneja varios canales PWM sobre objetos gpio_t a partir de
+ * un único temporizador de hardware. Los instantes de conmutación de todos los canales se ordenan
+ * de antemano, por lo que el temporizador solo interrumpe cuando algún canal debe cambiar y cada
+ * interrupción realiza una única escritura enmascarada por puerto.
+ */
+
+/* === Inclusión de archivos de cabecera ====================================================== */
+
+#include <stdint.h>
+#include "gpio.h"
+
+/* === Cabecera para C++ ====================================================================== */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Definición de macros públicas ========================================================= */
+
+#ifndef PWM_MAX_CHANNELS
+#define PWM_MAX_CHANNELS 16 /**< Número máximo de canales de cada generador. */
+#endif
+
+/* === Declaraciones de tipos de datos públicos ============================================ */
+
+/**
+ * @typedef pwm_t
+ * @brief Tipo de dato para representar un generador PWM.
+ */
+typedef struct pwm_s * pwm_t;
+
+/* === Declaraciones de variables públicas =================================================== */
+
+/* No se definen variables globales en este archivo */
+
+/* === Declaraciones de funciones públicas =================================================== */
+
+/**
+ * @brief Crea un generador PWM sobre un conjunto de pines.
+ *
+ * Los pines se configuran como salida y todos los canales comienzan con ciclo de trabajo nulo.
+ *
+ * @param timer Temporizador de hardware que utiliza el generador.
+ * @param frequency Frecuencia de cuenta del temporizador en Hz.
+ * @param period Duración del período PWM en cuentas del temporizador.
+ * @param outputs Arreglo con los pines de cada canal.
+ * @param count Cantidad de canales, como máximo PWM_MAX_CHANNELS.
+ *
+ * @return El generador creado o NULL si no hay generadores disponibles o los datos son inválidos.
+ */
+pwm_t pwmCreate(uint8_t timer, uint32_t frequency, uint32_t period, const gpio_t * outputs,
+                uint8_t count);
+
+/**
+ * @brief Cambia el ciclo de trabajo de un canal.
+ *
+ * El nuevo valor se aplica al comienzo del siguiente período, por lo que la señal nunca presenta
+ * pulsos incompletos.
+ *
+ * @param pwm Generador que se desea modificar.
+ * @param channel Número de canal, en el orden en que se entregaron los pines.
+ * @param duty Duración del estado alto en cuentas del temporizador, entre 0 y el período.
+ */
+void pwmSetDuty(pwm_t pwm, uint8_t channel, uint32_t duty);
+
+/**
+ * @brief Inicia la generación de las señales.
+ *
+ * @param pwm Generador que se desea iniciar.
+ */
+void pwmStart(pwm_t pwm);
+
+/**
+ * @brief Detiene la generación de las señales y pone en bajo todos los canales.
+ *
+ * @param pwm Generador que se desea detener.
+ */
+void pwmStop(pwm_t pwm);
+
+/* === Fin de la documentación ============================================================= */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWM_H */
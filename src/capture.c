@@ -0,0 +1,280 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file capture.c
+ * @brief Implementación de la captura de entradas al estilo de un analizador lógico.
+ *
+ * Cada muestra se compara con la corrida más reciente: si coincide solo se incrementa su longitud
+ * y, en caso contrario, se abre una corrida nueva, reemplazando la más antigua cuando el área de
+ * memoria está llena. La muestra de disparo siempre abre una corrida, de modo que su posición
+ * queda identificada por un índice.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "capture.h" /**< Declaraciones del capturador. */
+#include "gpio.h" /**< Lectura de los puertos a través de la biblioteca. */
+#include "gpio_backend.h" /**< Cantidad total de puertos, incluidos los virtuales. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y los temporizadores. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef CAPTURE_MAX_INSTANCES
+#define CAPTURE_MAX_INSTANCES 1 /**< Número máximo de capturadores que pueden ser creados. */
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estructura que representa un capturador.
+ */
+struct capture_s {
+    uint8_t timer;             /**< Temporizador que marca las muestras. */
+    uint8_t port;              /**< Puerto capturado. */
+    uint32_t mask;             /**< Pines capturados. */
+    capture_run_t * runs;      /**< Área de memoria circular de corridas. */
+    size_t size;               /**< Capacidad del área de memoria, en corridas. */
+    size_t head;               /**< Posición de la corrida más reciente. */
+    size_t count;              /**< Cantidad de corridas válidas. */
+    capture_trigger_t trigger; /**< Condición de disparo. */
+    uint32_t trigger_mask;     /**< Pines que intervienen en el disparo. */
+    uint32_t trigger_value;    /**< Valor de los pines para el disparo por nivel. */
+    uint32_t post;             /**< Muestras que se capturan después del disparo. */
+    uint32_t remaining;        /**< Muestras que faltan para terminar luego del disparo. */
+    uint32_t previous;         /**< Muestra anterior, para el disparo por cambio. */
+    size_t triggered_at;       /**< Corridas abiertas desde el disparo, incluida la del disparo. */
+    bool triggered;            /**< Indica si ya se produjo el disparo. */
+    volatile bool running;     /**< Indica si la captura está en curso. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Atiende la interrupción del temporizador del capturador.
+ *
+ * @param context Capturador que debe tomar la muestra.
+ * @return uint32_t Una cuenta hasta la próxima muestra, o cero si la captura terminó.
+ */
+static uint32_t timerHandler(void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Arreglo estático que almacena los capturadores. */
+static struct capture_s instances[CAPTURE_MAX_INSTANCES] = {0};
+
+/** Cantidad de capturadores ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Atiende la interrupción del temporizador del capturador.
+ *
+ * El temporizador cuenta a la frecuencia de muestreo, por lo que cada muestra programa la
+ * siguiente una cuenta después.
+ *
+ * @param context Capturador que debe tomar la muestra.
+ * @return uint32_t Una cuenta hasta la próxima muestra, o cero si la captura terminó.
+ */
+static uint32_t timerHandler(void * context) {
+    return captureSample(context) ? 1 : 0;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un capturador para un conjunto de pines de un puerto.
+ *
+ * @param timer Temporizador de hardware que marca el instante de cada muestra.
+ * @param port Puerto que se desea capturar.
+ * @param mask Máscara con los pines capturados.
+ * @param runs Área de memoria circular donde se guardan las corridas.
+ * @param size Cantidad de corridas que caben en el área de memoria.
+ * @return capture_t Capturador creado o NULL si no se pudo crear.
+ */
+capture_t captureCreate(uint8_t timer, uint8_t port, uint32_t mask, capture_run_t * runs,
+                        size_t size) {
+    capture_t self = NULL;
+
+    if (timer >= HAL_TIMER_COUNT || port >= GPIO_PORTS) {
+        return NULL;
+    }
+    if (instances_used < CAPTURE_MAX_INSTANCES && runs && size > 0) {
+        self = &instances[instances_used++];
+        self->timer = timer;
+        self->port = port;
+        self->mask = mask;
+        self->runs = runs;
+        self->size = size;
+        self->trigger = CAPTURE_TRIGGER_NONE;
+        self->running = false;
+    }
+    return self;
+}
+
+/**
+ * @brief Configura la condición de disparo de la captura.
+ *
+ * @param self Capturador que se desea configurar.
+ * @param trigger Condición de disparo.
+ * @param mask Máscara con los pines que intervienen en la condición.
+ * @param value Valor de los pines para el disparo por nivel.
+ * @param post Cantidad de muestras que se capturan después del disparo.
+ */
+void captureSetTrigger(capture_t self, capture_trigger_t trigger, uint32_t mask, uint32_t value,
+                       uint32_t post) {
+    self->trigger = trigger;
+    self->trigger_mask = mask;
+    self->trigger_value = value & mask;
+    self->post = post;
+}
+
+/**
+ * @brief Inicia la captura, descartando las muestras anteriores.
+ *
+ * @param self Capturador que se desea iniciar.
+ * @param rate Cantidad de muestras por segundo.
+ * @return bool true si la captura se inició, false si la frecuencia es cero.
+ */
+bool captureStart(capture_t self, uint32_t rate) {
+    if (rate == 0) {
+        return false; /**< El temporizador nunca tomaría una muestra. */
+    }
+    self->head = 0;
+    self->count = 0;
+    self->triggered = false;
+    self->triggered_at = 0;
+    self->remaining = self->post;
+    self->previous = gpioPortRead(self->port);
+    self->running = true;
+    hal_timer_start(self->timer, rate, 1, timerHandler, self);
+    return true;
+}
+
+/**
+ * @brief Detiene la captura.
+ *
+ * @param self Capturador que se desea detener.
+ */
+void captureStop(capture_t self) {
+    hal_timer_stop(self->timer);
+    self->running = false;
+}
+
+/**
+ * @brief Toma una muestra del puerto.
+ *
+ * La condición de disparo se evalúa sobre la muestra completa del puerto, antes de aplicar la
+ * máscara de pines capturados.
+ *
+ * @param self Capturador que debe tomar la muestra.
+ * @return bool true si la captura continúa, false si terminó.
+ */
+bool captureSample(capture_t self) {
+    if (!self->running) {
+        return false;
+    }
+
+    uint32_t sample = gpioPortRead(self->port);
+    uint32_t value = sample & self->mask;
+    bool trigger = false;
+
+    if (!self->triggered) {
+        if (self->trigger == CAPTURE_TRIGGER_LEVEL) {
+            trigger = (sample & self->trigger_mask) == self->trigger_value;
+        } else if (self->trigger == CAPTURE_TRIGGER_CHANGE) {
+            trigger = ((sample ^ self->previous) & self->trigger_mask) != 0;
+        }
+        self->previous = sample;
+    }
+
+    capture_run_t * run = &self->runs[self->head];
+    if (self->count > 0 && !trigger && run->value == value && run->length < UINT32_MAX) {
+        run->length++;
+    } else {
+        if (self->count > 0) {
+            self->head = (self->head + 1) % self->size;
+        }
+        if (self->count < self->size) {
+            self->count++;
+        }
+        self->runs[self->head].value = value;
+        self->runs[self->head].length = 1;
+        if (self->triggered || trigger) {
+            self->triggered_at++;
+        }
+    }
+
+    if (trigger) {
+        self->triggered = true;
+    } else if (self->triggered && self->remaining > 0) {
+        self->remaining--;
+    }
+    if (self->triggered && self->remaining == 0) {
+        self->running = false; /**< Se capturaron todas las muestras posteriores al disparo. */
+    }
+    return self->running;
+}
+
+/**
+ * @brief Indica si la captura está en curso.
+ *
+ * @param self Capturador consultado.
+ * @return bool true si la captura está en curso.
+ */
+bool captureRunning(capture_t self) {
+    return self->running;
+}
+
+/**
+ * @brief Copia las corridas capturadas, de la más antigua a la más reciente.
+ *
+ * @param self Capturador consultado.
+ * @param runs Arreglo donde se copian las corridas.
+ * @param max Cantidad máxima de corridas que se pueden copiar en el arreglo.
+ * @param trigger Si no es NULL, recibe la posición de la corrida de disparo en `runs`.
+ * @return size_t Cantidad de corridas copiadas.
+ */
+size_t captureRead(capture_t self, capture_run_t * runs, size_t max, size_t * trigger) {
+    size_t count = (self->count < max) ? self->count : max;
+    size_t first = (self->head + self->size + 1 - self->count) % self->size;
+
+    for (size_t index = 0; index < count; index++) {
+        runs[index] = self->runs[(first + index) % self->size];
+    }
+    if (trigger) {
+        *trigger = max;
+        if (self->triggered && self->triggered_at <= self->count) {
+            size_t position = self->count - self->triggered_at;
+            *trigger = (position < count) ? position : max;
+        }
+    }
+    return count;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,208 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file debounce.c
+ * @brief Implementación del filtro antirrebote con contadores verticales.
+ *
+ * Los contadores de los 32 pines de un puerto se almacenan por planos: la palabra `counter[k]`
+ * contiene el bit k del contador de cada pin. Incrementar, comparar y reiniciar los contadores se
+ * reduce a operaciones lógicas sobre esas palabras, con un costo que no depende de la cantidad de
+ * pines filtrados.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "debounce.h" /**< Declaraciones del filtro antirrebote. */
+#include <stddef.h> /**< Biblioteca estándar que define los macros para NULL y tamaños. */
+#include "gpio.h" /**< Lectura de los puertos a través de la biblioteca. */
+#include "gpio_backend.h" /**< Cantidad total de puertos, incluidos los virtuales. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef DEBOUNCE_MAX_INSTANCES
+#define DEBOUNCE_MAX_INSTANCES 4 /**< Número máximo de filtros que pueden ser creados. */
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estructura que representa un filtro antirrebote.
+ */
+struct debounce_s {
+    uint8_t port;                            /**< Puerto que se muestrea en cada llamada. */
+    uint32_t mask;                           /**< Pines del puerto que se filtran. */
+    uint32_t state;                          /**< Estado estable de cada pin. */
+    uint32_t counter[DEBOUNCE_COUNTER_BITS]; /**< Contadores de cada pin, un plano por bit. */
+    uint32_t limit[DEBOUNCE_COUNTER_BITS];   /**< Muestras necesarias de cada pin, por planos. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Arreglo estático que almacena los filtros. */
+static struct debounce_s instances[DEBOUNCE_MAX_INSTANCES] = {0};
+
+/** Cantidad de filtros ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un filtro antirrebote para un conjunto de pines de un puerto.
+ *
+ * @param port Puerto que se desea filtrar o DEBOUNCE_NO_PORT.
+ * @param mask Máscara con los pines del puerto que se desean filtrar.
+ * @param count Cantidad de muestras consecutivas necesarias para aceptar un cambio.
+ * @return debounce_t Filtro creado o NULL si el puerto no existe o no hay filtros disponibles.
+ */
+debounce_t debounceCreate(uint8_t port, uint32_t mask, uint8_t count) {
+    debounce_t self = NULL;
+
+    if (port >= GPIO_PORTS && port != DEBOUNCE_NO_PORT) {
+        return NULL;
+    }
+    if (instances_used < DEBOUNCE_MAX_INSTANCES) {
+        self = &instances[instances_used++];
+        self->port = port;
+        self->mask = mask;
+        self->state = 0;
+        if (port != DEBOUNCE_NO_PORT) {
+            self->state = gpioPortRead(port) & mask; /**< Estado inicial del puerto. */
+        }
+        debounceSetCount(self, mask, count);
+    }
+    return self;
+}
+
+/**
+ * @brief Cambia la cantidad de muestras necesarias para aceptar un cambio en algunos pines.
+ *
+ * Cada bit de la cantidad se copia en el plano correspondiente del límite, para los pines de la
+ * máscara. Los valores fuera de rango se ajustan al rango permitido.
+ *
+ * @param self Filtro que se desea configurar.
+ * @param mask Máscara con los pines que se desean configurar.
+ * @param count Cantidad de muestras consecutivas.
+ */
+void debounceSetCount(debounce_t self, uint32_t mask, uint8_t count) {
+    if (count < 1) {
+        count = 1;
+    } else if (count > DEBOUNCE_MAX_COUNT) {
+        count = DEBOUNCE_MAX_COUNT;
+    }
+
+    for (int plane = 0; plane < DEBOUNCE_COUNTER_BITS; plane++) {
+        if (count & (1 << plane)) {
+            self->limit[plane] |= mask;
+        } else {
+            self->limit[plane] &= ~mask;
+        }
+        self->counter[plane] &= ~mask; /**< Reinicia los contadores modificados. */
+    }
+}
+
+/**
+ * @brief Muestrea el puerto y actualiza el filtro.
+ *
+ * @param self Filtro que se desea actualizar.
+ * @return uint32_t Máscara con los pines cuyo estado estable cambió.
+ */
+uint32_t debounceTick(debounce_t self) {
+    if (self->port == DEBOUNCE_NO_PORT) {
+        return 0; /**< El filtro solo recibe muestras de la aplicación. */
+    }
+    return debounceFilter(self, gpioPortRead(self->port));
+}
+
+/**
+ * @brief Actualiza el filtro con una muestra provista por la aplicación.
+ *
+ * Los contadores de los pines cuya muestra difiere del estado estable se incrementan con una
+ * suma con acarreo por planos, mientras que los del resto se ponen en cero. Los pines cuyo
+ * contador alcanza su límite cambian de estado y reinician su contador.
+ *
+ * @param self Filtro que se desea actualizar.
+ * @param sample Muestra con un bit por cada entrada filtrada.
+ * @return uint32_t Máscara con las entradas cuyo estado estable cambió.
+ */
+uint32_t debounceFilter(debounce_t self, uint32_t sample) {
+    uint32_t differ = (sample ^ self->state) & self->mask;
+    uint32_t carry = differ;
+    uint32_t reached = differ;
+
+    for (int plane = 0; plane < DEBOUNCE_COUNTER_BITS; plane++) {
+        uint32_t counter = self->counter[plane];
+
+        self->counter[plane] = (counter ^ carry) & differ; /**< Incrementa o reinicia. */
+        carry &= counter;
+        reached &= ~(self->counter[plane] ^ self->limit[plane]);
+    }
+
+    for (int plane = 0; plane < DEBOUNCE_COUNTER_BITS; plane++) {
+        self->counter[plane] &= ~reached; /**< Reinicia los contadores que llegaron al límite. */
+    }
+    self->state ^= reached;
+    return reached;
+}
+
+/**
+ * @brief Obtiene el estado estable de las entradas filtradas.
+ *
+ * @param self Filtro consultado.
+ * @return uint32_t Estado estable, un bit por cada entrada.
+ */
+uint32_t debounceGetState(debounce_t self) {
+    return self->state;
+}
+
+/**
+ * @brief Fija el estado estable de las entradas filtradas.
+ *
+ * @param self Filtro que se desea modificar.
+ * @param state Estado estable, un bit por cada entrada.
+ */
+void debounceSetState(debounce_t self, uint32_t state) {
+    self->state = state & self->mask;
+    for (int plane = 0; plane < DEBOUNCE_COUNTER_BITS; plane++) {
+        self->counter[plane] = 0;
+    }
+}
+
+/**
+ * @brief Obtiene la cantidad de filtros que todavía pueden crearse.
+ *
+ * @return uint8_t Cantidad de filtros disponibles.
+ */
+uint8_t debounceAvailable(void) {
+    return DEBOUNCE_MAX_INSTANCES - instances_used;
+}
+
+/* === End of documentation ==================================================================== */
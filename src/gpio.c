@@ -36,6 +36,16 @@ SPDX-License-Identifier: MIT
 #include <string.h> /**< Biblioteca estándar para manipulación de cadenas. */
 #include <stddef.h> /**< Biblioteca estándar que define los macros para NULL y tamaños. */
 #include "hal.h" /**< Archivo que abstrae las funciones de hardware para controlar los pines GPIO. */
+#include "gpio_backend.h" /**< Puertos virtuales implementados por expansores externos. */
+#ifdef USE_FAST_GPIO
+#include "gpio_fast.h" /**< Datos precalculados para el acceso rápido a los pines GPIO. */
+#endif
+#ifdef USE_GPIO_TRACE
+#include "gpio_trace.h" /**< Registro de la actividad de los GPIO. */
+#endif
+#ifdef USE_DYNAMIC_MEM
+#include <stdlib.h> /**< Biblioteca estándar para la reserva de memoria dinámica. */
+#endif
 
 /* === Macros definitions ====================================================================== */
 
@@ -43,6 +53,102 @@ SPDX-License-Identifier: MIT
 #define GPIO_MAX_INSTANCES 10 /**< Número máximo de instancias de GPIO que pueden ser creadas. */
 #endif
 
+#if defined(USE_DYNAMIC_MEM) && defined(USE_POOL_MEM)
+#error "USE_DYNAMIC_MEM y USE_POOL_MEM no pueden definirse a la vez"
+#endif
+
+#if !defined(USE_DYNAMIC_MEM) && !defined(USE_POOL_MEM)
+#define USE_STATIC_MEM /**< Las instancias se asignan desde un arreglo estático. */
+#endif
+
+#if defined(USE_GPIO_THREAD_SAFE) && !defined(USE_ATOMIC_GPIO)
+#define USE_ATOMIC_GPIO /**< El modo seguro entre núcleos requiere las escrituras atómicas. */
+#endif
+
+_Static_assert(GPIO_PORTS <= 32, "Los mapas de puertos requieren como máximo 32 puertos");
+
+#ifdef USE_STATIC_MEM
+/** Cantidad de palabras de 32 bits necesarias para el mapa de instancias ocupadas. */
+#define GPIO_SLOT_WORDS ((GPIO_MAX_INSTANCES + 31) / 32)
+
+_Static_assert(GPIO_SLOT_WORDS <= 32, "GPIO_MAX_INSTANCES no puede superar 1024");
+#endif
+
+#ifdef USE_GPIO_STATS
+/**
+ * @brief Ejecuta un acceso a la HAL sobre un puerto registrándolo en sus estadísticas.
+ *
+ * Se cuenta el acceso en el campo indicado y se acumula su duración medida con hal_timestamp().
+ * En la HAL simulada ese contador no avanza durante un acceso, de modo que la duración es cero.
+ */
+#define GPIO_STATS_CALL(port, field, call)                                                         \
+    do {                                                                                           \
+        uint32_t stats_start = hal_timestamp();                                                    \
+        call;                                                                                      \
+        stats[port].cycles += hal_timestamp() - stats_start;                                       \
+        stats[port].field++;                                                                       \
+    } while (0)
+
+/** Cuenta un evento en las estadísticas de un puerto. */
+#define GPIO_STATS_COUNT(port, field) (stats[port].field++)
+#else
+#define GPIO_STATS_CALL(port, field, call) call
+#define GPIO_STATS_COUNT(port, field)      ((void)0)
+#endif
+
+#if GPIO_VIRTUAL_PORTS > 0
+/**
+ * @brief Ejecuta un acceso a la HAL sobre un puerto nativo o marca como pendiente un puerto
+ * virtual.
+ *
+ * Las copias en memoria ya contienen el nuevo estado, por lo que un puerto virtual solo necesita
+ * registrarse en el mapa de puertos pendientes indicado para que gpioFlush() lo envíe.
+ */
+#define GPIO_PORT_ACCESS(port, field, pending, call)                                               \
+    do {                                                                                           \
+        if ((port) < HAL_GPIO_PORTS) {                                                             \
+            GPIO_STATS_CALL(port, field, call);                                                    \
+        } else {                                                                                   \
+            stateWrite(&(pending), (uint32_t)1 << (port), UINT32_MAX);                             \
+            GPIO_STATS_COUNT(port, field);                                                         \
+        }                                                                                          \
+    } while (0)
+#else
+#define GPIO_PORT_ACCESS(port, field, pending, call) GPIO_STATS_CALL(port, field, call)
+#endif
+
+#ifdef USE_GPIO_TRACE
+/** Registra el estado de las salidas de un puerto luego de escribirlas. */
+#define GPIO_TRACE_writes(port) gpioTraceRecord(GPIO_TRACE_OUTPUT, port, shadow[port])
+
+/** Registra la dirección de los pines de un puerto luego de configurarla. */
+#define GPIO_TRACE_directions(port) gpioTraceRecord(GPIO_TRACE_DIRECTION, port, direction[port])
+
+/**
+ * @brief Ejecuta un acceso de escritura a un puerto y registra su nuevo estado.
+ *
+ * El campo de las estadísticas selecciona el tipo de registro, por lo que cada punto en que se
+ * cuenta una escritura o un cambio de dirección también queda registrado.
+ */
+#define GPIO_PORT_CALL(port, field, pending, call)                                                 \
+    do {                                                                                           \
+        GPIO_PORT_ACCESS(port, field, pending, call);                                              \
+        GPIO_TRACE_##field(port);                                                                  \
+    } while (0)
+
+/** Registra un valor de un puerto que no proviene de las copias en memoria. */
+#define GPIO_TRACE_RECORD(kind, port, value) gpioTraceRecord(kind, port, value)
+#else
+#define GPIO_PORT_CALL(port, field, pending, call) GPIO_PORT_ACCESS(port, field, pending, call)
+#define GPIO_TRACE_RECORD(kind, port, value)       ((void)0)
+#endif
+
+#if defined(USE_ATOMIC_GPIO) && defined(HAL_GPIO_PIN_WORD_REGISTER)
+#define GPIO_ATOMIC_WORD /**< Cada pin se escribe con su registro de palabra o su alias de bit. */
+#elif defined(USE_ATOMIC_GPIO) && HAL_GPIO_DIRECT_ACCESS
+#define GPIO_ATOMIC_SET_CLEAR /**< Cada pin se escribe con los registros de set y clear. */
+#endif
+
 /* === Private data type declarations ========================================================== */
 
 /**
@@ -52,131 +158,1368 @@ SPDX-License-Identifier: MIT
  * como el puerto y el bit del pin, así como su estado (si es de salida o entrada).
  */
 struct gpio_s {
+#ifdef USE_FAST_GPIO
+    struct gpio_fast_s fast; /**< Datos para el acceso rápido, debe ser el primer campo. */
+#endif
     uint8_t port; /**< Puerto donde se encuentra el pin GPIO. */
     uint8_t bit;  /**< Número de bit dentro del puerto para el pin GPIO. */
     bool output;  /**< Indica si el pin está configurado como salida (true) o entrada (false). */
-#ifndef USE_DYNAMIC_MEM
-    bool used; /**< Indica si la instancia de GPIO está en uso (solo para asignación estática). */
+#ifdef USE_DYNAMIC_MEM
+    uint16_t id; /**< Identificador secuencial asignado al crear la instancia. */
+#endif
+#if defined(GPIO_ATOMIC_WORD)
+    volatile uint32_t * word; /**< Registro cuya escritura fija el nivel del pin. */
+#elif defined(GPIO_ATOMIC_SET_CLEAR)
+    volatile uint32_t * set;   /**< Registro que pone en alto los bits escritos. */
+    volatile uint32_t * clear; /**< Registro que pone en bajo los bits escritos. */
+#endif
+
+    gpio_edge_cb_t on_edge; /**< Función que se invoca ante los flancos del pin o NULL. */
+    void * context;         /**< Puntero que se entrega a la función `on_edge`. */
+};
+
+#if GPIO_VIRTUAL_PORTS > 0
+/**
+ * @brief Controlador asociado a un puerto virtual.
+ *
+ * Todos los puertos de un mismo controlador guardan una copia de los mismos datos, de forma que
+ * desde cualquiera de ellos se obtienen el controlador y el rango completo de sus puertos.
+ */
+struct gpio_virtual_s {
+    const gpio_backend_t * backend; /**< Operaciones del controlador o NULL si no tiene. */
+    void * context;                 /**< Puntero que se entrega a las operaciones. */
+    uint8_t first;                  /**< Primer puerto del controlador. */
+    uint8_t count;                  /**< Cantidad de puertos del controlador. */
+};
 #endif
+
+#ifdef USE_POOL_MEM
+/**
+ * @brief Bloque del pool de instancias.
+ *
+ * Mientras el bloque está libre su memoria se utiliza para enlazarlo con el siguiente bloque libre,
+ * por lo que el pool no necesita espacio adicional para administrarse.
+ */
+union gpio_block_u {
+    struct gpio_s gpio;        /**< Instancia de GPIO almacenada en el bloque ocupado. */
+    union gpio_block_u * next; /**< Siguiente bloque de la lista de bloques libres. */
 };
+#endif
 
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
 /**
- * @brief Asigna una instancia de GPIO de manera estática.
+ * @brief Asigna una instancia de GPIO sin utilizar memoria dinámica.
  *
- * Esta función asigna una instancia libre del arreglo estático de GPIOs. Si no hay instancias
- * libres, retorna NULL.
+ * Esta función asigna una instancia libre del arreglo estático de GPIOs o del pool provisto por la
+ * aplicación. Si no hay instancias libres, retorna NULL.
  *
  * @return gpio_t Instancia asignada de GPIO o NULL si no hay espacio.
  */
 #ifndef USE_DYNAMIC_MEM
 static gpio_t allocateInstance(void);
+
+/**
+ * @brief Libera una instancia de GPIO asignada sin utilizar memoria dinámica.
+ *
+ * @param self Instancia que se devuelve al arreglo estático o al pool.
+ */
+static void releaseInstance(gpio_t self);
+#endif
+
+/**
+ * @brief Atiende las interrupciones de flanco de los pines de un puerto.
+ *
+ * @param port Puerto cuyos pines generaron la interrupción.
+ * @param pending Máscara con los pines que tienen una interrupción pendiente.
+ * @param levels Estado de los pines del puerto en el momento de la interrupción.
+ */
+static void edgeDispatcher(uint8_t port, uint32_t pending, uint32_t levels);
+
+/**
+ * @brief Modifica los bits seleccionados de una copia en memoria de un registro.
+ *
+ * @param word Palabra que se modifica.
+ * @param mask Bits que se modifican.
+ * @param value Valor de los bits seleccionados.
+ */
+static inline void stateWrite(uint32_t * word, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Invierte los bits seleccionados de una copia en memoria de un registro.
+ *
+ * @param word Palabra que se modifica.
+ * @param mask Bits que se invierten.
+ */
+static inline void stateToggle(uint32_t * word, uint32_t mask);
+
+/**
+ * @brief Determina si una escritura de las salidas de un puerto puede omitirse.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Pines que se desean escribir.
+ * @param value Valor de los pines seleccionados.
+ * @return bool true si la escritura no modifica ningún pin y debe omitirse.
+ */
+static inline bool outputElided(uint8_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Determina si un cambio de dirección de los pines de un puerto puede omitirse.
+ *
+ * @param port Puerto que se desea configurar.
+ * @param mask Pines que se desean configurar.
+ * @param outputs Pines seleccionados que deben quedar como salida.
+ * @return bool true si el cambio no modifica ningún pin y debe omitirse.
+ */
+static inline bool directionElided(uint8_t port, uint32_t mask, uint32_t outputs);
+
+/**
+ * @brief Reserva un pin para una instancia.
+ *
+ * @param port Puerto del pin.
+ * @param mask Máscara del pin en su puerto.
+ * @return bool true si el pin estaba libre y quedó reservado.
+ */
+static inline bool pinClaim(uint8_t port, uint32_t mask);
+
+/**
+ * @brief Libera un pin reservado con pinClaim().
+ *
+ * @param port Puerto del pin.
+ * @param mask Máscara del pin en su puerto.
+ */
+static inline void pinRelease(uint8_t port, uint32_t mask);
+
+/**
+ * @brief Determina si un puerto pertenece a otro núcleo.
+ *
+ * @param port Puerto que se desea modificar.
+ * @return bool true si la modificación debe descartarse.
+ */
+static inline bool portForeign(uint8_t port);
+
+#if GPIO_VIRTUAL_PORTS > 0
+/**
+ * @brief Lee el nivel de los pines de un puerto virtual.
+ *
+ * @param port Puerto virtual que se desea leer.
+ * @return uint32_t Nivel de los pines del puerto.
+ */
+static uint32_t virtualRead(uint8_t port);
 #endif
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/**
+ * @brief Copia en memoria del registro de salida de cada puerto.
+ *
+ * Cada palabra refleja el último valor escrito en los pines del puerto correspondiente, lo que
+ * permite invertir o consultar una salida sin leer el hardware.
+ */
+static uint32_t shadow[GPIO_PORTS] = {0};
+
+/** Copia en memoria del registro de dirección de cada puerto, un bit en uno por cada salida. */
+static uint32_t direction[GPIO_PORTS] = {0};
+
+/** Mapa de bits de los pines de cada puerto que pertenecen a un objeto. */
+static uint32_t pins_used[GPIO_PORTS] = {0};
+
+/** Tabla que asocia cada pin con el objeto que lo controla, indexada por puerto y bit. */
+static gpio_t owners[GPIO_PORTS][HAL_GPIO_PORT_WIDTH] = {0};
+
+#ifdef USE_GPIO_STATS
+/** Estadísticas de acceso de cada puerto. */
+static gpio_stats_t stats[GPIO_PORTS] = {0};
+#endif
+
+#ifdef USE_WRITE_ELISION
+/** Pines de cada puerto cuya salida en el hardware coincide con el registro sombra. */
+static uint32_t known_outputs[GPIO_PORTS] = {0};
+
+/** Pines de cada puerto cuya dirección en el hardware coincide con la copia en memoria. */
+static uint32_t known_directions[GPIO_PORTS] = {0};
+
+/** Cantidad de escrituras omitidas por no modificar ningún pin. */
+static uint32_t elided_writes = 0;
+#endif
+
+#if GPIO_VIRTUAL_PORTS > 0
+/** Controladores de los puertos virtuales, indexados a partir del primer puerto virtual. */
+static struct gpio_virtual_s virtual_ports[GPIO_VIRTUAL_PORTS] = {0};
+
+/** Mapa de los puertos virtuales cuyas salidas deben enviarse al controlador. */
+static uint32_t pending_outputs = 0;
+
+/** Mapa de los puertos virtuales cuya dirección debe enviarse al controlador. */
+static uint32_t pending_directions = 0;
+#endif
+
+#ifdef USE_GPIO_THREAD_SAFE
+/** Núcleo dueño de cada puerto más uno, o cero si el puerto es compartido. */
+static uint8_t port_owners[GPIO_PORTS] = {0};
+#endif
+
+/** Indica si la función de atención de interrupciones ya fue registrada en la HAL. */
+static bool edge_dispatcher_installed = false;
+
+#ifdef USE_STATIC_MEM
+/** Arreglo estático que almacena las instancias de GPIO. */
+static struct gpio_s instances[GPIO_MAX_INSTANCES] = {0};
+
+/** Mapa de bits de las instancias ocupadas, un bit por cada elemento de `instances`. */
+static uint32_t slots_used[GPIO_SLOT_WORDS] = {0};
+
+/** Mapa de bits de las palabras de `slots_used` que no tienen instancias libres. */
+static uint32_t slots_full = 0;
+#endif
+
+#ifdef USE_DYNAMIC_MEM
+/** Identificador que se asignará a la próxima instancia creada. */
+static uint16_t next_id = 0;
+#endif
+
+#ifdef USE_POOL_MEM
+/** Primer bloque del pool provisto por la aplicación. */
+static union gpio_block_u * pool_blocks = NULL;
+
+/** Primer bloque de la lista de bloques libres del pool. */
+static union gpio_block_u * pool_free = NULL;
+
+#ifdef USE_GPIO_THREAD_SAFE
+/** Cerrojo que protege la lista de bloques libres del pool. */
+static bool pool_lock = false;
+#endif
+#endif
+
 /* === Private function implementation ========================================================= */
 
 /**
  * @brief Asigna una instancia de GPIO de manera estática.
  *
- * Esta función busca una instancia no utilizada en el arreglo estático de instancias de GPIO y
- * la marca como utilizada. Si no se encuentran instancias libres, retorna NULL.
+ * Esta función busca la primera palabra del mapa de ocupación que tiene algún bit libre y, dentro
+ * de ella, el primer bit en cero. Ambas búsquedas se resuelven con una única instrucción de conteo
+ * de ceros, por lo que el tiempo de asignación no depende de la cantidad de instancias. Si no se
+ * encuentran instancias libres, retorna NULL.
+ *
+ * Con `USE_GPIO_THREAD_SAFE` el bit se reclama con una comparación e intercambio atómico; si otro
+ * núcleo modificó la palabra entre la lectura y la escritura, la búsqueda se repite con el valor
+ * actualizado.
  *
  * @return gpio_t Instancia de GPIO libre o NULL si no hay instancias disponibles.
  */
-#ifndef USE_DYNAMIC_MEM
-static gpio_t allocateInstance() {
-    static struct gpio_s instances[GPIO_MAX_INSTANCES] = {
-        0}; /**< Arreglo estático que almacena las instancias de GPIO. */
-
+#ifdef USE_STATIC_MEM
+static gpio_t allocateInstance(void) {
     gpio_t result = NULL;
-    for (int index = 0; index < GPIO_MAX_INSTANCES; index++) {
-        if (!instances[index].used) {
-            result = &instances[index]; /**< Asigna la instancia disponible. */
-            result->used = true;        /**< Marca la instancia como usada. */
-            break;
+
+#ifdef USE_GPIO_THREAD_SAFE
+    uint32_t full = __atomic_load_n(&slots_full, __ATOMIC_RELAXED);
+
+    while (result == NULL && ~full != 0 && __builtin_ctz(~full) < GPIO_SLOT_WORDS) {
+        unsigned int word = __builtin_ctz(~full);
+        uint32_t used = __atomic_load_n(&slots_used[word], __ATOMIC_RELAXED);
+
+        while (result == NULL && ~used != 0) {
+            unsigned int index = 32 * word + __builtin_ctz(~used);
+            uint32_t slot = (uint32_t)1 << (index % 32);
+
+            if (index >= GPIO_MAX_INSTANCES) {
+                break;
+            }
+            if (__atomic_compare_exchange_n(&slots_used[word], &used, used | slot, false,
+                                            __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                result = &instances[index]; /**< Ningún otro núcleo reclamó la instancia. */
+                if ((used | slot) == UINT32_MAX) {
+                    __atomic_fetch_or(&slots_full, (uint32_t)1 << word, __ATOMIC_RELAXED);
+                    if (__atomic_load_n(&slots_used[word], __ATOMIC_RELAXED) != UINT32_MAX) {
+                        /* Otro núcleo liberó una instancia de la palabra mientras se marcaba */
+                        __atomic_fetch_and(&slots_full, ~((uint32_t)1 << word), __ATOMIC_RELAXED);
+                    }
+                }
+            }
         }
+        full |= (uint32_t)1 << word; /**< La palabra no tiene instancias libres utilizables. */
     }
+#else
+    if (~slots_full != 0) {
+        unsigned int word = __builtin_ctz(~slots_full);
+        if (word < GPIO_SLOT_WORDS) {
+            unsigned int index = 32 * word + __builtin_ctz(~slots_used[word]);
+            if (index < GPIO_MAX_INSTANCES) {
+                slots_used[word] |= (uint32_t)1 << (index % 32); /**< Marca la instancia. */
+                if (slots_used[word] == UINT32_MAX) {
+                    slots_full |= (uint32_t)1 << word;
+                }
+                result = &instances[index]; /**< Asigna la instancia disponible. */
+            }
+        }
+    }
+#endif
     return result;
 }
+
+/**
+ * @brief Libera una instancia de GPIO asignada de manera estática.
+ *
+ * La posición de la instancia dentro del arreglo determina el bit que se debe liberar en el mapa
+ * de ocupación.
+ *
+ * @param self Instancia que se devuelve al arreglo estático.
+ */
+static void releaseInstance(gpio_t self) {
+    unsigned int index = self - instances;
+
+#ifdef USE_GPIO_THREAD_SAFE
+    __atomic_fetch_and(&slots_used[index / 32], ~((uint32_t)1 << (index % 32)), __ATOMIC_RELEASE);
+    __atomic_fetch_and(&slots_full, ~((uint32_t)1 << (index / 32)), __ATOMIC_RELAXED);
+#else
+    slots_used[index / 32] &= ~((uint32_t)1 << (index % 32)); /**< Marca la instancia como libre. */
+    slots_full &= ~((uint32_t)1 << (index / 32));
+#endif
+}
 #endif
 
-/* === Public function implementation ========================================================== */
+/**
+ * @brief Asigna una instancia de GPIO desde el pool.
+ *
+ * Esta función toma el primer bloque de la lista de bloques libres, por lo que el tiempo de
+ * asignación es constante. Si el pool no fue inicializado o está agotado, retorna NULL.
+ *
+ * @return gpio_t Instancia de GPIO libre o NULL si no hay bloques disponibles.
+ */
+#ifdef USE_POOL_MEM
+static gpio_t allocateInstance(void) {
+    gpio_t result = NULL;
+
+#ifdef USE_GPIO_THREAD_SAFE
+    while (__atomic_test_and_set(&pool_lock, __ATOMIC_ACQUIRE)) {
+    }
+#endif
+    if (pool_free) {
+        result = &pool_free->gpio;  /**< Asigna el bloque disponible. */
+        pool_free = pool_free->next; /**< Lo retira de la lista de bloques libres. */
+    }
+#ifdef USE_GPIO_THREAD_SAFE
+    __atomic_clear(&pool_lock, __ATOMIC_RELEASE);
+#endif
+    return result;
+}
 
 /**
- * @brief Crea una nueva instancia de GPIO.
+ * @brief Devuelve una instancia de GPIO al pool.
  *
- * Esta función crea una nueva instancia de un pin GPIO y la configura con el puerto y bit
- * especificados. Si se utiliza memoria dinámica, se reserva espacio para la nueva instancia;
- * de lo contrario, se asigna de manera estática.
+ * @param self Instancia que se agrega al principio de la lista de bloques libres.
+ */
+static void releaseInstance(gpio_t self) {
+    union gpio_block_u * block = (union gpio_block_u *)self;
+
+#ifdef USE_GPIO_THREAD_SAFE
+    while (__atomic_test_and_set(&pool_lock, __ATOMIC_ACQUIRE)) {
+    }
+#endif
+    block->next = pool_free;
+    pool_free = block;
+#ifdef USE_GPIO_THREAD_SAFE
+    __atomic_clear(&pool_lock, __ATOMIC_RELEASE);
+#endif
+}
+#endif
+
+/**
+ * @brief Atiende las interrupciones de flanco de los pines de un puerto.
  *
- * @param port El puerto en el que se encuentra el pin GPIO.
- * @param bit El bit dentro del puerto del pin GPIO.
- * @return gpio_t Instancia de GPIO creada, o NULL si hubo un error al crearla.
+ * Esta función recorre solo los bits en uno de la máscara de pendientes, extrayendo en cada paso
+ * el de menor peso, y consulta la tabla de dueños del puerto para invocar la función registrada.
+ *
+ * @param port Puerto cuyos pines generaron la interrupción.
+ * @param pending Máscara con los pines que tienen una interrupción pendiente.
+ * @param levels Estado de los pines del puerto en el momento de la interrupción.
  */
-gpio_t gpioCreate(uint8_t port, uint8_t bit) {
-#ifdef USE_DYNAMIC_MEM
-    gpio_t self = malloc(
-        sizeof(struct gpio_s)); /**< Reserva memoria dinámica para una nueva instancia de GPIO. */
+static void edgeDispatcher(uint8_t port, uint32_t pending, uint32_t levels) {
+    GPIO_TRACE_RECORD(GPIO_TRACE_INPUT, port, levels); /**< Estado de las entradas. */
+    while (pending) {
+        unsigned int bit = __builtin_ctz(pending);
+        gpio_t self = owners[port][bit];
+
+        pending &= pending - 1; /**< Descarta el pin que se está atendiendo. */
+        if (self && self->on_edge) {
+            self->on_edge(self, (levels >> bit) & 1, self->context);
+        }
+    }
+}
+
+/**
+ * @brief Modifica los bits seleccionados de una copia en memoria de un registro.
+ *
+ * Con `USE_ATOMIC_GPIO` la modificación se reintenta hasta completarse sin que otro contexto haya
+ * escrito la palabra en el medio, por lo que el programa principal y las interrupciones pueden
+ * modificar pines distintos de un mismo puerto sin deshabilitar las interrupciones. En un núcleo
+ * ARMv7-M el compilador la resuelve con las instrucciones LDREX y STREX.
+ *
+ * @param word Palabra que se modifica.
+ * @param mask Bits que se modifican.
+ * @param value Valor de los bits seleccionados.
+ */
+static inline void stateWrite(uint32_t * word, uint32_t mask, uint32_t value) {
+#ifdef USE_ATOMIC_GPIO
+    uint32_t current = __atomic_load_n(word, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(word, &current, (current & ~mask) | (value & mask), true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
 #else
-    gpio_t self = allocateInstance(); /**< Asigna una instancia estática de GPIO. */
+    *word = (*word & ~mask) | (value & mask);
 #endif
+}
 
-    if (self) {
-        self->port = port;    /**< Establece el puerto del GPIO. */
-        self->bit = bit;      /**< Establece el bit del GPIO. */
-        self->output = false; /**< Establece el pin como entrada por defecto. */
+/**
+ * @brief Invierte los bits seleccionados de una copia en memoria de un registro.
+ *
+ * @param word Palabra que se modifica.
+ * @param mask Bits que se invierten.
+ */
+static inline void stateToggle(uint32_t * word, uint32_t mask) {
+#ifdef USE_ATOMIC_GPIO
+    __atomic_fetch_xor(word, mask, __ATOMIC_RELAXED);
+#else
+    *word ^= mask;
+#endif
+}
+
+/**
+ * @brief Determina si una escritura de las salidas de un puerto puede omitirse.
+ *
+ * Con `USE_WRITE_ELISION` la escritura se omite cuando todos los pines seleccionados tienen un
+ * estado conocido igual al pedido. Si no se omite, los pines pasan a tener un estado conocido. Sin
+ * esa definición la función siempre retorna false y el compilador elimina la comparación.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Pines que se desean escribir.
+ * @param value Valor de los pines seleccionados.
+ * @return bool true si la escritura no modifica ningún pin y debe omitirse.
+ */
+static inline bool outputElided(uint8_t port, uint32_t mask, uint32_t value) {
+#ifdef USE_WRITE_ELISION
+    if ((mask & ~(known_outputs[port] & ~(shadow[port] ^ value))) == 0) {
+        elided_writes++;
+        return true;
     }
-    return self; /**< Retorna la instancia creada o NULL si falló la creación. */
+    stateWrite(&known_outputs[port], mask, UINT32_MAX);
+#else
+    (void)port;
+    (void)mask;
+    (void)value;
+#endif
+    return false;
 }
 
 /**
- * @brief Configura un pin GPIO como salida o entrada.
+ * @brief Determina si un cambio de dirección de los pines de un puerto puede omitirse.
  *
- * Esta función configura el pin GPIO como salida o entrada, dependiendo del valor del parámetro
- * `output`. Además, ajusta la dirección del pin a través de la capa de abstracción de hardware.
+ * Funciona igual que outputElided() sobre la copia en memoria del registro de dirección.
  *
- * @param self Instancia de GPIO que se desea configurar.
- * @param output Valor booleano que indica si el pin debe ser configurado como salida (true) o
- * entrada (false).
+ * @param port Puerto que se desea configurar.
+ * @param mask Pines que se desean configurar.
+ * @param outputs Pines seleccionados que deben quedar como salida.
+ * @return bool true si el cambio no modifica ningún pin y debe omitirse.
  */
-void gpioSetOutput(gpio_t self, bool output) {
-    self->output = output; /**< Establece si el pin es salida o entrada. */
-    hal_gpio_set_direction(self->port, self->bit, output); /**< Configura la dirección del pin. */
+static inline bool directionElided(uint8_t port, uint32_t mask, uint32_t outputs) {
+#ifdef USE_WRITE_ELISION
+    if ((mask & ~(known_directions[port] & ~(direction[port] ^ outputs))) == 0) {
+        elided_writes++;
+        return true;
+    }
+    stateWrite(&known_directions[port], mask, UINT32_MAX);
+#else
+    (void)port;
+    (void)mask;
+    (void)outputs;
+#endif
+    return false;
 }
 
 /**
- * @brief Establece el estado de un pin GPIO (solo para pines de salida).
+ * @brief Reserva un pin para una instancia.
  *
- * Esta función establece el estado del pin GPIO (alto o bajo) si está configurado como salida.
+ * Con `USE_GPIO_THREAD_SAFE` la consulta y la reserva se realizan con una única operación atómica,
+ * por lo que dos núcleos que crean el mismo pin a la vez nunca obtienen ambos una instancia.
  *
- * @param self Instancia de GPIO cuyo estado se desea cambiar.
- * @param state Valor booleano que indica el estado del pin (true para alto, false para bajo).
+ * @param port Puerto del pin.
+ * @param mask Máscara del pin en su puerto.
+ * @return bool true si el pin estaba libre y quedó reservado.
  */
-void gpioSetState(gpio_t self, bool state) {
-    if (self->output) {
-        hal_gpio_set_output(self->port, self->bit,
-                            state); /**< Establece el estado del pin si es salida. */
+static inline bool pinClaim(uint8_t port, uint32_t mask) {
+#ifdef USE_GPIO_THREAD_SAFE
+    return (__atomic_fetch_or(&pins_used[port], mask, __ATOMIC_ACQUIRE) & mask) == 0;
+#else
+    if (pins_used[port] & mask) {
+        return false;
     }
+    pins_used[port] |= mask;
+    return true;
+#endif
 }
 
 /**
- * @brief Obtiene el estado de un pin GPIO (solo para pines de entrada).
+ * @brief Libera un pin reservado con pinClaim().
  *
- * Esta función obtiene el estado de un pin GPIO configurado como entrada.
+ * @param port Puerto del pin.
+ * @param mask Máscara del pin en su puerto.
+ */
+static inline void pinRelease(uint8_t port, uint32_t mask) {
+#ifdef USE_GPIO_THREAD_SAFE
+    __atomic_fetch_and(&pins_used[port], ~mask, __ATOMIC_RELEASE);
+#else
+    pins_used[port] &= ~mask;
+#endif
+}
+
+/**
+ * @brief Determina si un puerto pertenece a otro núcleo.
  *
- * @param self Instancia de GPIO cuyo estado de entrada se desea obtener.
- * @return bool El estado del pin (true si está alto, false si está bajo).
+ * Sin `USE_GPIO_THREAD_SAFE` la función siempre retorna false y el compilador elimina la
+ * comparación.
+ *
+ * @param port Puerto que se desea modificar.
+ * @return bool true si la modificación debe descartarse.
  */
-bool gpioGetState(gpio_t self) {
-    return hal_gpio_get_input(self->port,
-                              self->bit); /**< Retorna el estado del pin como entrada. */
+static inline bool portForeign(uint8_t port) {
+#ifdef USE_GPIO_THREAD_SAFE
+    uint8_t owner = __atomic_load_n(&port_owners[port], __ATOMIC_RELAXED);
+
+    if (owner != 0 && owner != hal_cpu_id() + 1) {
+        GPIO_STATS_COUNT(port, dropped);
+        return true;
+    }
+#else
+    (void)port;
+#endif
+    return false;
+}
+
+#if GPIO_VIRTUAL_PORTS > 0
+/**
+ * @brief Lee el nivel de los pines de un puerto virtual.
+ *
+ * Si el controlador no permite leer, o todavía no fue asociado, se devuelve el registro sombra.
+ *
+ * @param port Puerto virtual que se desea leer.
+ * @return uint32_t Nivel de los pines del puerto.
+ */
+static uint32_t virtualRead(uint8_t port) {
+    const struct gpio_virtual_s * entry = &virtual_ports[port - HAL_GPIO_PORTS];
+    uint32_t levels = shadow[port];
+
+    if (entry->backend != NULL && entry->backend->read != NULL) {
+        GPIO_STATS_CALL(port, reads,
+                        levels = entry->backend->read(entry->context, port - entry->first));
+    }
+    return levels;
 }
+#endif
+
+/* === Public function implementation ========================================================== */
+
+#ifdef USE_POOL_MEM
+/**
+ * @brief Inicializa el pool de instancias de GPIO.
+ *
+ * Esta función alinea el inicio del área de memoria, la divide en bloques del tamaño de una
+ * instancia y los enlaza en la lista de bloques libres. Las instancias creadas con un pool anterior
+ * dejan de ser válidas.
+ *
+ * @param buffer Área de memoria provista por la aplicación.
+ * @param size Tamaño en bytes del área de memoria.
+ * @return size_t Cantidad de instancias que se pueden crear con el pool.
+ */
+size_t gpioPoolInit(void * buffer, size_t size) {
+    const uintptr_t align = _Alignof(union gpio_block_u);
+    uintptr_t start = (uintptr_t)buffer;
+    uintptr_t aligned = (start + align - 1) & ~(align - 1); /**< Primer bloque alineado. */
+    size_t count = 0;
+
+    if (buffer && (aligned - start) < size) {
+        count = (size - (aligned - start)) / sizeof(union gpio_block_u);
+    }
+
+    pool_blocks = count ? (union gpio_block_u *)aligned : NULL;
+    pool_free = pool_blocks;
+    for (size_t index = 0; index < count; index++) {
+        pool_blocks[index].next = (index + 1 < count) ? &pool_blocks[index + 1] : NULL;
+    }
+    return count;
+}
+#endif
+
+/**
+ * @brief Crea una nueva instancia de GPIO.
+ *
+ * Esta función crea una nueva instancia de un pin GPIO y la configura con el puerto y bit
+ * especificados, tomando como dirección inicial la que tenga el pin en ese momento (entrada
+ * luego del reinicio). Si se utiliza memoria dinámica, se reserva espacio para la nueva
+ * instancia; si se utiliza un pool, se toma un bloque libre del mismo; de lo contrario, se asigna
+ * de manera estática.
+ *
+ * Antes de asignar la instancia se consulta el mapa de pines ocupados del puerto, de forma que dos
+ * objetos nunca controlan el mismo pin. La verificación no depende de la cantidad de instancias.
+ *
+ * @param port El puerto en el que se encuentra el pin GPIO.
+ * @param bit El bit dentro del puerto del pin GPIO.
+ * @return gpio_t Instancia de GPIO creada, o NULL si el pin no existe, ya pertenece a otra
+ * instancia o no hay espacio para crearla.
+ */
+gpio_t gpioCreate(uint8_t port, uint8_t bit) {
+    if (port >= GPIO_PORTS || bit >= HAL_GPIO_PORT_WIDTH || !pinClaim(port, (uint32_t)1 << bit)) {
+        return NULL; /**< El pin no existe o ya tiene dueño. */
+    }
+
+#ifdef USE_DYNAMIC_MEM
+    gpio_t self = malloc(
+        sizeof(struct gpio_s)); /**< Reserva memoria dinámica para una nueva instancia de GPIO. */
+#else
+    gpio_t self = allocateInstance(); /**< Asigna una instancia estática o del pool. */
+#endif
+
+    if (self) {
+        self->port = port;    /**< Establece el puerto del GPIO. */
+        self->bit = bit;      /**< Establece el bit del GPIO. */
+        self->output = (direction[port] & gpioGetMask(self)) != 0; /**< Dirección actual. */
+#ifdef USE_DYNAMIC_MEM
+#ifdef USE_GPIO_THREAD_SAFE
+        self->id = __atomic_fetch_add(&next_id, 1, __ATOMIC_RELAXED);
+#else
+        self->id = next_id++; /**< Asigna el identificador secuencial. */
+#endif
+#endif
+        self->on_edge = NULL; /**< El pin no notifica flancos por defecto. */
+        self->context = NULL;
+#if defined(GPIO_ATOMIC_WORD) || defined(GPIO_ATOMIC_SET_CLEAR) || defined(USE_FAST_GPIO)
+        /* Los pines virtuales no tienen registros en la HAL, sus accesos directos se resuelven
+         * sobre el puerto 0 con una máscara nula y no tienen efecto */
+        bool native = port < HAL_GPIO_PORTS;
+#endif
+#if defined(GPIO_ATOMIC_SET_CLEAR) || defined(USE_FAST_GPIO)
+        uint8_t registers = native ? port : 0;
+#endif
+#if defined(GPIO_ATOMIC_WORD)
+        self->word = native ? &HAL_GPIO_PIN_WORD_REGISTER(port, bit) : NULL; /**< Acceso atómico. */
+#elif defined(GPIO_ATOMIC_SET_CLEAR)
+        self->set = &HAL_GPIO_SET_REGISTER(registers); /**< Resuelve el acceso atómico. */
+        self->clear = &HAL_GPIO_CLEAR_REGISTER(registers);
+#endif
+#ifdef USE_FAST_GPIO
+        self->fast.mask = native ? gpioGetMask(self) : 0; /**< Precalcula el acceso rápido. */
+#if HAL_GPIO_DIRECT_ACCESS
+        self->fast.set = &HAL_GPIO_SET_REGISTER(registers);
+        self->fast.clear = &HAL_GPIO_CLEAR_REGISTER(registers);
+        self->fast.toggle = &HAL_GPIO_TOGGLE_REGISTER(registers);
+        self->fast.input = &HAL_GPIO_PIN_REGISTER(registers);
+#else
+        self->fast.port = registers;
+#endif
+#endif
+#ifdef USE_GPIO_THREAD_SAFE
+        __atomic_store_n(&owners[port][bit], self, __ATOMIC_RELEASE); /**< Publica la instancia. */
+#else
+        owners[port][bit] = self;
+#endif
+    } else {
+        pinRelease(port, (uint32_t)1 << bit); /**< No hay instancias, el pin queda libre. */
+    }
+    return self; /**< Retorna la instancia creada o NULL si falló la creación. */
+}
+
+/**
+ * @brief Destruye una instancia de GPIO.
+ *
+ * Esta función devuelve la instancia al mecanismo de asignación: si se utiliza memoria dinámica se
+ * libera la memoria reservada; de lo contrario, la posición del arreglo estático queda disponible
+ * para un nuevo gpioCreate(). El pin queda libre para otra instancia y la configuración del
+ * hardware no se modifica. Una instancia que ya no es dueña de su pin, porque fue destruida, se
+ * ignora.
+ *
+ * @param self Instancia de GPIO que se desea destruir, puede ser NULL.
+ */
+void gpioDestroy(gpio_t self) {
+    if (self == NULL) {
+        return;
+    }
+#ifdef USE_GPIO_THREAD_SAFE
+    if (__atomic_load_n(&owners[self->port][self->bit], __ATOMIC_ACQUIRE) != self) {
+        return; /**< La instancia ya fue destruida, el pin puede pertenecer a otra. */
+    }
+#else
+    if (owners[self->port][self->bit] != self) {
+        return; /**< La instancia ya fue destruida, el pin puede pertenecer a otra. */
+    }
+#endif
+    gpioOnEdge(self, GPIO_EDGE_NONE, NULL, NULL); /**< Deshabilita los flancos del pin. */
+#ifdef USE_GPIO_THREAD_SAFE
+    __atomic_store_n(&owners[self->port][self->bit], NULL, __ATOMIC_RELEASE);
+#else
+    owners[self->port][self->bit] = NULL;
+#endif
+    pinRelease(self->port, gpioGetMask(self)); /**< Libera el pin. */
+#ifdef USE_DYNAMIC_MEM
+    free(self); /**< Libera la memoria dinámica de la instancia. */
+#else
+    releaseInstance(self); /**< Libera la instancia estática o del pool. */
+#endif
+}
+
+/**
+ * @brief Obtiene el identificador compacto de una instancia de GPIO.
+ *
+ * En la asignación estática y en el pool el identificador se calcula a partir de la posición de
+ * la instancia, por lo que no ocupa memoria adicional.
+ *
+ * @param self Instancia de GPIO consultada.
+ * @return uint16_t Identificador de la instancia.
+ */
+uint16_t gpioGetId(gpio_t self) {
+#if defined(USE_DYNAMIC_MEM)
+    return self->id;
+#elif defined(USE_POOL_MEM)
+    return (uint16_t)((union gpio_block_u *)self - pool_blocks);
+#else
+    return (uint16_t)(self - instances);
+#endif
+}
+
+/**
+ * @brief Configura un pin GPIO como salida o entrada.
+ *
+ * Esta función configura el pin GPIO como salida o entrada, dependiendo del valor del parámetro
+ * `output`. Además, ajusta la dirección del pin a través de la capa de abstracción de hardware.
+ *
+ * @param self Instancia de GPIO que se desea configurar.
+ * @param output Valor booleano que indica si el pin debe ser configurado como salida (true) o
+ * entrada (false).
+ */
+void gpioSetOutput(gpio_t self, bool output) {
+    if (portForeign(self->port)) {
+        return; /**< El puerto pertenece a otro núcleo. */
+    }
+    self->output = output; /**< Establece si el pin es salida o entrada. */
+    if (directionElided(self->port, gpioGetMask(self), output ? UINT32_MAX : 0)) {
+        return; /**< El pin ya tiene la dirección pedida. */
+    }
+    stateWrite(&direction[self->port], gpioGetMask(self), output ? UINT32_MAX : 0);
+    GPIO_PORT_CALL(self->port, directions, pending_directions,
+                   hal_gpio_set_direction(self->port, self->bit, output));
+}
+
+/**
+ * @brief Establece el estado de un pin GPIO (solo para pines de salida).
+ *
+ * Esta función establece el estado del pin GPIO (alto o bajo) si está configurado como salida.
+ * Con `USE_ATOMIC_GPIO` el pin se escribe con un único almacenamiento en el registro resuelto en
+ * gpioCreate(), sin leer el puerto, y la copia en memoria se actualiza en forma atómica.
+ *
+ * @param self Instancia de GPIO cuyo estado se desea cambiar.
+ * @param state Valor booleano que indica el estado del pin (true para alto, false para bajo).
+ */
+void gpioSetState(gpio_t self, bool state) {
+    if (self->output) {
+        if (portForeign(self->port)) {
+            return; /**< El puerto pertenece a otro núcleo. */
+        }
+        if (outputElided(self->port, gpioGetMask(self), state ? UINT32_MAX : 0)) {
+            return; /**< El pin ya tiene el estado pedido. */
+        }
+        stateWrite(&shadow[self->port], gpioGetMask(self), state ? UINT32_MAX : 0);
+#if defined(GPIO_ATOMIC_WORD)
+        GPIO_PORT_CALL(self->port, writes, pending_outputs, *self->word = state);
+#elif defined(GPIO_ATOMIC_SET_CLEAR)
+        GPIO_PORT_CALL(self->port, writes, pending_outputs,
+                       *(state ? self->set : self->clear) = gpioGetMask(self));
+#else
+        GPIO_PORT_CALL(self->port, writes, pending_outputs,
+                       hal_gpio_set_output(self->port, self->bit, state));
+#endif
+    } else {
+        GPIO_STATS_COUNT(self->port, dropped); /**< El pin es una entrada. */
+    }
+}
+
+/**
+ * @brief Obtiene el estado de un pin GPIO (solo para pines de entrada).
+ *
+ * Esta función obtiene el estado de un pin GPIO configurado como entrada.
+ *
+ * @param self Instancia de GPIO cuyo estado de entrada se desea obtener.
+ * @return bool El estado del pin (true si está alto, false si está bajo).
+ */
+bool gpioGetState(gpio_t self) {
+    bool state;
+
+#if GPIO_VIRTUAL_PORTS > 0
+    if (self->port >= HAL_GPIO_PORTS) {
+        return (virtualRead(self->port) & gpioGetMask(self)) != 0;
+    }
+#endif
+    GPIO_STATS_CALL(self->port, reads, state = hal_gpio_get_input(self->port, self->bit));
+    return state;
+}
+
+/**
+ * @brief Invierte el estado de un pin GPIO (solo para pines de salida).
+ *
+ * El estado actual se toma del registro sombra del puerto, por lo que la operación no requiere
+ * leer el hardware. Con `USE_ATOMIC_GPIO` se utiliza el registro de inversión del puerto, de forma
+ * que la lectura del estado y la escritura no pueden quedar separadas por una interrupción.
+ *
+ * @param self Instancia de GPIO cuyo estado se desea invertir.
+ */
+void gpioToggle(gpio_t self) {
+#ifdef USE_ATOMIC_GPIO
+    if (self->output) {
+        gpioPortToggle(self->port, gpioGetMask(self));
+    }
+#else
+    gpioSetState(self, !gpioGetOutputLatch(self));
+#endif
+}
+
+/**
+ * @brief Obtiene el último estado escrito en un pin GPIO.
+ *
+ * @param self Instancia de GPIO consultada.
+ * @return bool El valor del pin en el registro sombra del puerto.
+ */
+bool gpioGetOutputLatch(gpio_t self) {
+    return (shadow[self->port] & gpioGetMask(self)) != 0;
+}
+
+/**
+ * @brief Registra una función que se invoca ante los flancos de un pin GPIO.
+ *
+ * La rutina de interrupción encuentra el objeto en la tabla de dueños de los pines, completada en
+ * gpioCreate(). La función se registra antes de habilitar la interrupción y se retira después de
+ * deshabilitarla, de forma que la rutina nunca encuentra una entrada a medio configurar.
+ *
+ * @param self Instancia de GPIO cuyo pin se desea observar.
+ * @param edge Flancos que se desean notificar, GPIO_EDGE_NONE deshabilita la notificación.
+ * @param callback Función que se invoca ante cada flanco, NULL deshabilita la notificación.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ * @return bool true si se configuró la notificación, false si la instancia no es la dueña del pin,
+ * si el pin es virtual o si la HAL no puede observarlo.
+ */
+bool gpioOnEdge(gpio_t self, gpio_edge_t edge, gpio_edge_cb_t callback, void * context) {
+    if (owners[self->port][self->bit] != self) {
+        return false; /**< La instancia ya fue destruida. */
+    }
+#if GPIO_VIRTUAL_PORTS > 0
+    if (self->port >= HAL_GPIO_PORTS) {
+        return edge == GPIO_EDGE_NONE; /**< Los puertos virtuales no generan interrupciones. */
+    }
+#endif
+
+    if (edge == GPIO_EDGE_NONE || callback == NULL) {
+        if (self->on_edge) {
+            hal_gpio_set_edge(self->port, self->bit, HAL_GPIO_EDGE_NONE);
+        }
+        self->on_edge = NULL;
+        self->context = NULL;
+    } else {
+        if (!edge_dispatcher_installed) {
+            hal_gpio_set_irq_handler(edgeDispatcher);
+            edge_dispatcher_installed = true;
+        }
+        self->context = context;
+        self->on_edge = callback;
+        if (!hal_gpio_set_edge(self->port, self->bit, (hal_gpio_edge_t)edge)) {
+            self->on_edge = NULL; /**< La plataforma no puede observar el pin. */
+            self->context = NULL;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Busca la instancia que controla un pin.
+ *
+ * @param port Puerto del pin.
+ * @param bit Bit del pin dentro del puerto.
+ * @return gpio_t Instancia dueña del pin o NULL si el pin no pertenece a ninguna.
+ */
+gpio_t gpioFind(gpio_port_t port, uint8_t bit) {
+    if (port >= GPIO_PORTS || bit >= HAL_GPIO_PORT_WIDTH) {
+        return NULL;
+    }
+    return owners[port][bit];
+}
+
+/**
+ * @brief Obtiene los pines de un puerto que pertenecen a alguna instancia.
+ *
+ * @param port Puerto consultado.
+ * @return uint32_t Máscara con un bit en uno por cada pin ocupado.
+ */
+uint32_t gpioPortUsed(gpio_port_t port) {
+    return port < GPIO_PORTS ? pins_used[port] : 0;
+}
+
+/**
+ * @brief Configura un conjunto de pines a partir de una tabla.
+ *
+ * Esta función recorre la tabla una sola vez acumulando, para cada puerto, la máscara de pines
+ * involucrados, la de salidas y la de niveles iniciales. Luego escribe primero el registro de
+ * salida y después el de dirección de cada puerto, con lo que las salidas arrancan en su nivel
+ * inicial sin pulsos espurios. Las entradas con un puerto o un bit fuera de rango se descartan, y
+ * los objetos que ya controlan alguno de los pines actualizan su dirección.
+ *
+ * @param table Tabla con la configuración de cada pin.
+ * @param count Cantidad de entradas de la tabla.
+ */
+void gpioConfigureTable(const gpio_config_t * table, size_t count) {
+    uint32_t pins[GPIO_PORTS] = {0};    /**< Pines configurados en cada puerto. */
+    uint32_t outputs[GPIO_PORTS] = {0}; /**< Pines configurados como salida. */
+    uint32_t states[GPIO_PORTS] = {0};  /**< Salidas que arrancan en estado alto. */
+
+    for (size_t index = 0; index < count; index++) {
+        if (table[index].port >= GPIO_PORTS || table[index].bit >= HAL_GPIO_PORT_WIDTH) {
+            continue; /**< La entrada no corresponde a un pin válido. */
+        }
+
+        uint32_t mask = (uint32_t)1 << table[index].bit;
+
+        pins[table[index].port] |= mask;
+        if (table[index].output) {
+            outputs[table[index].port] |= mask;
+            if (table[index].state) {
+                states[table[index].port] |= mask;
+            }
+        }
+    }
+
+    for (uint8_t port = 0; port < GPIO_PORTS; port++) {
+        if (pins[port] && !portForeign(port)) {
+            if (outputs[port]) {
+                gpioPortWrite(port, outputs[port], states[port]);
+            }
+            gpioPortSetOutput(port, pins[port], outputs[port]);
+        }
+    }
+}
+
+/**
+ * @brief Obtiene el puerto al que pertenece un pin GPIO.
+ *
+ * @param self Instancia de GPIO consultada.
+ * @return gpio_port_t Puerto del pin.
+ */
+gpio_port_t gpioGetPort(gpio_t self) {
+    return self->port;
+}
+
+/**
+ * @brief Obtiene la máscara de bits de un pin GPIO dentro de su puerto.
+ *
+ * @param self Instancia de GPIO consultada.
+ * @return uint32_t Máscara con el bit del pin activo.
+ */
+uint32_t gpioGetMask(gpio_t self) {
+    return (uint32_t)1 << self->bit;
+}
+
+/**
+ * @brief Pone en alto varios pines de un puerto en una única operación.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben pasar a estado alto.
+ */
+void gpioPortSet(gpio_port_t port, uint32_t mask) {
+    if (port >= GPIO_PORTS || portForeign(port)) {
+        return; /**< El puerto no existe o pertenece a otro núcleo. */
+    }
+    if (outputElided(port, mask, UINT32_MAX)) {
+        return;
+    }
+    stateWrite(&shadow[port], mask, UINT32_MAX);
+    GPIO_PORT_CALL(port, writes, pending_outputs, hal_gpio_set_port_mask(port, mask, 0));
+}
+
+/**
+ * @brief Pone en bajo varios pines de un puerto en una única operación.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben pasar a estado bajo.
+ */
+void gpioPortClear(gpio_port_t port, uint32_t mask) {
+    if (port >= GPIO_PORTS || portForeign(port)) {
+        return; /**< El puerto no existe o pertenece a otro núcleo. */
+    }
+    if (outputElided(port, mask, 0)) {
+        return;
+    }
+    stateWrite(&shadow[port], mask, 0);
+    GPIO_PORT_CALL(port, writes, pending_outputs, hal_gpio_set_port_mask(port, 0, mask));
+}
+
+/**
+ * @brief Invierte el estado de varios pines de un puerto en una única operación.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que deben cambiar de estado.
+ */
+void gpioPortToggle(gpio_port_t port, uint32_t mask) {
+    if (port >= GPIO_PORTS || portForeign(port)) {
+        return; /**< El puerto no existe o pertenece a otro núcleo. */
+    }
+    stateToggle(&shadow[port], mask);
+    GPIO_PORT_CALL(port, writes, pending_outputs, hal_gpio_toggle_port_mask(port, mask));
+}
+
+/**
+ * @brief Escribe un valor sobre varios pines de un puerto en una única operación.
+ *
+ * Los bits de `value` seleccionados por `mask` se separan en una máscara de set y otra de reset,
+ * que se entregan juntas a la capa de hardware para que todos los pines cambien a la vez.
+ *
+ * @param port Puerto que se desea modificar.
+ * @param mask Máscara con los pines que se deben escribir.
+ * @param value Valor que se desea escribir en los pines seleccionados.
+ */
+void gpioPortWrite(gpio_port_t port, uint32_t mask, uint32_t value) {
+    if (port >= GPIO_PORTS || portForeign(port)) {
+        return; /**< El puerto no existe o pertenece a otro núcleo. */
+    }
+    if (outputElided(port, mask, value)) {
+        return;
+    }
+    stateWrite(&shadow[port], mask, value);
+    GPIO_PORT_CALL(port, writes, pending_outputs,
+                   hal_gpio_set_port_mask(port, value & mask, ~value & mask));
+}
+
+/**
+ * @brief Lee el estado de todos los pines de un puerto en un único acceso.
+ *
+ * @param port Puerto que se desea leer.
+ * @return uint32_t Estado de los pines del puerto, un bit por pin.
+ */
+uint32_t gpioPortRead(gpio_port_t port) {
+    uint32_t levels;
+
+    if (port >= GPIO_PORTS) {
+        return 0; /**< El puerto no existe. */
+    }
+#if GPIO_VIRTUAL_PORTS > 0
+    if (port >= HAL_GPIO_PORTS) {
+        return virtualRead(port);
+    }
+#endif
+    GPIO_STATS_CALL(port, reads, levels = hal_gpio_get_port(port));
+    return levels;
+}
+
+/**
+ * @brief Configura la dirección de varios pines de un puerto en una única operación.
+ *
+ * Los objetos GPIO de los pines modificados adoptan la nueva dirección, de forma que gpioSetState()
+ * sigue escribiendo los pines que quedaron como salida.
+ *
+ * @param port Puerto que se desea configurar.
+ * @param mask Máscara con los pines que se deben configurar.
+ * @param outputs Máscara con los pines que deben quedar como salida.
+ */
+void gpioPortSetOutput(gpio_port_t port, uint32_t mask, uint32_t outputs) {
+    if (port >= GPIO_PORTS || portForeign(port)) {
+        return; /**< El puerto no existe o pertenece a otro núcleo. */
+    }
+    for (uint32_t owned = mask & pins_used[port]; owned; owned &= owned - 1) {
+        unsigned int bit = __builtin_ctz(owned);
+        gpio_t self = owners[port][bit];
+
+        if (self) {
+            self->output = (outputs >> bit) & 1; /**< Adopta la dirección. */
+        }
+    }
+    if (directionElided(port, mask, outputs)) {
+        return; /**< Los pines ya tienen la dirección pedida. */
+    }
+    stateWrite(&direction[port], mask, outputs);
+    GPIO_PORT_CALL(port, directions, pending_directions,
+                   hal_gpio_set_port_direction(port, mask, outputs));
+}
+
+/**
+ * @brief Obtiene el último estado escrito en las salidas de un puerto.
+ *
+ * @param port Puerto consultado.
+ * @return uint32_t El registro sombra del puerto, o cero si el puerto no existe.
+ */
+uint32_t gpioPortGetOutputLatch(gpio_port_t port) {
+    return port < GPIO_PORTS ? shadow[port] : 0;
+}
+
+/**
+ * @brief Reúne el estado de varios pines en una única palabra.
+ *
+ * Cada puerto se lee una sola vez, la primera vez que aparece en la lista, y los pines restantes de
+ * ese puerto se toman de la misma lectura. La máscara `sampled` registra los puertos ya leídos.
+ *
+ * @param pins Lista de pines, el primero corresponde al bit 0 del resultado.
+ * @param count Cantidad de pines, como máximo 32.
+ * @return uint32_t Estado de los pines, un bit por pin en el orden de la lista.
+ */
+uint32_t gpioGather(const gpio_t * pins, size_t count) {
+    uint32_t levels[GPIO_PORTS];
+    uint32_t sampled = 0;
+    uint32_t result = 0;
+
+    if (count > 32) {
+        count = 32;
+    }
+    for (size_t index = 0; index < count; index++) {
+        uint8_t port = pins[index]->port;
+
+        if ((sampled & ((uint32_t)1 << port)) == 0) {
+            levels[port] = gpioPortRead(port); /**< Primera aparición del puerto. */
+            sampled |= (uint32_t)1 << port;
+        }
+        result |= ((levels[port] >> pins[index]->bit) & 1) << index;
+    }
+    return result;
+}
+
+/**
+ * @brief Indica que el estado de las salidas de un puerto fue modificado sin pasar por la
+ * biblioteca.
+ *
+ * Con `USE_WRITE_ELISION` la próxima escritura de los pines indicados se realiza aunque el
+ * registro sombra indique que no cambian. Sin esa definición la función no hace nada.
+ *
+ * @param port Puerto cuyas salidas fueron modificadas.
+ * @param mask Pines cuyo estado dejó de ser conocido.
+ */
+void gpioPortInvalidate(gpio_port_t port, uint32_t mask) {
+#ifdef USE_WRITE_ELISION
+    if (port >= GPIO_PORTS) {
+        return; /**< El puerto no existe. */
+    }
+    stateWrite(&known_outputs[port], mask, 0);
+#else
+    (void)port;
+    (void)mask;
+#endif
+}
+
+/**
+ * @brief Prepara los pines para un modo de bajo consumo.
+ *
+ * Solo se escribe la dirección de los pines que cambian, y las copias en memoria no se modifican
+ * para que gpioResume() restablezca la configuración anterior. Por ese motivo el registro de
+ * actividad recibe la dirección escrita y no la de la copia. Con `USE_WRITE_ELISION` la dirección
+ * de esos pines deja de ser conocida hasta el restablecimiento. Los puertos de otro núcleo y los
+ * puertos virtuales no se modifican.
+ *
+ * @param wake Salidas de cada puerto que se mantienen como fuentes de despertar o NULL.
+ * @param count Cantidad de posiciones del arreglo.
+ */
+void gpioSuspend(const uint32_t * wake, size_t count) {
+    for (uint8_t port = 0; port < HAL_GPIO_PORTS; port++) {
+        uint32_t pins = direction[port] & pins_used[port];
+
+        if (wake != NULL && port < count) {
+            pins &= ~wake[port];
+        }
+        if (pins && !portForeign(port)) {
+#ifdef USE_WRITE_ELISION
+            stateWrite(&known_directions[port], pins, 0);
+#endif
+            GPIO_PORT_ACCESS(port, directions, pending_directions,
+                             hal_gpio_set_port_direction(port, pins, 0));
+            GPIO_TRACE_RECORD(GPIO_TRACE_DIRECTION, port, direction[port] & ~pins);
+        }
+    }
+}
+
+/**
+ * @brief Restablece los pines después de un modo de bajo consumo.
+ *
+ * Los registros se escriben a partir del registro sombra y de la copia de la dirección, para
+ * todos los pines que pertenecen a algún objeto, aunque el hardware los haya conservado. Como en
+ * gpioSuspend(), los puertos de otro núcleo y los puertos virtuales no se modifican.
+ */
+void gpioResume(void) {
+    for (uint8_t port = 0; port < HAL_GPIO_PORTS; port++) {
+        uint32_t pins = pins_used[port];
+        uint32_t outputs = direction[port] & pins;
+
+        if (pins && !portForeign(port)) {
+            if (outputs) {
+                GPIO_PORT_CALL(port, writes, pending_outputs,
+                               hal_gpio_set_port_mask(port, shadow[port] & outputs,
+                                                      ~shadow[port] & outputs));
+            }
+            GPIO_PORT_CALL(port, directions, pending_directions,
+                           hal_gpio_set_port_direction(port, pins, outputs));
+#ifdef USE_WRITE_ELISION
+            stateWrite(&known_outputs[port], outputs, UINT32_MAX);
+            stateWrite(&known_directions[port], pins, UINT32_MAX);
+#endif
+        }
+    }
+}
+
+/**
+ * @brief Asocia un controlador a un conjunto de puertos virtuales consecutivos.
+ *
+ * @param port Primer puerto del controlador.
+ * @param count Cantidad de puertos del controlador.
+ * @param backend Operaciones del controlador.
+ * @param context Puntero que se entrega a las operaciones del controlador.
+ * @return bool true si el controlador se asoció.
+ */
+bool gpioBackendAttach(gpio_port_t port, uint8_t count, const gpio_backend_t * backend,
+                       void * context) {
+#if GPIO_VIRTUAL_PORTS > 0
+    if (backend == NULL || backend->write == NULL || count == 0 || port < HAL_GPIO_PORTS ||
+        port + count > GPIO_PORTS) {
+        return false;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if (virtual_ports[port + index - HAL_GPIO_PORTS].backend != NULL) {
+            return false; /**< El puerto ya tiene un controlador. */
+        }
+    }
+
+    for (uint8_t index = 0; index < count; index++) {
+        struct gpio_virtual_s * entry = &virtual_ports[port + index - HAL_GPIO_PORTS];
+
+        entry->context = context;
+        entry->first = port;
+        entry->count = count;
+        entry->backend = backend;
+    }
+    uint32_t ports = (((uint32_t)1 << count) - 1) << port;
+    stateWrite(&pending_outputs, ports, UINT32_MAX);
+    stateWrite(&pending_directions, ports, UINT32_MAX);
+    return true;
+#else
+    (void)port;
+    (void)count;
+    (void)backend;
+    (void)context;
+    return false;
+#endif
+}
+
+/**
+ * @brief Envía a los controladores el estado de los puertos virtuales pendientes.
+ *
+ * Los mapas de puertos pendientes se limpian antes de leer las copias en memoria, por lo que una
+ * escritura que ocurre durante el envío, por ejemplo desde una interrupción, vuelve a marcar su
+ * puerto y se envía en la siguiente llamada. En cada controlador las salidas se escriben antes que
+ * la dirección, para que los pines que pasan a ser salidas arranquen con su nivel.
+ */
+void gpioFlush(void) {
+#if GPIO_VIRTUAL_PORTS > 0
+    uint32_t outputs = pending_outputs;
+    uint32_t directions = pending_directions;
+
+    stateWrite(&pending_outputs, outputs, 0);
+    stateWrite(&pending_directions, directions, 0);
+
+    uint32_t ports = outputs | directions;
+    while (ports) {
+        const struct gpio_virtual_s * entry =
+            &virtual_ports[__builtin_ctz(ports) - HAL_GPIO_PORTS];
+
+        if (entry->backend == NULL) {
+            ports &= ports - 1; /**< gpioBackendAttach() vuelve a marcar el puerto. */
+            continue;
+        }
+        uint32_t span = (((uint32_t)1 << entry->count) - 1) << entry->first;
+        ports &= ~span;
+        if (outputs & span) {
+            entry->backend->write(entry->context, &shadow[entry->first], entry->count);
+        }
+        if ((directions & span) && entry->backend->direction != NULL) {
+            entry->backend->direction(entry->context, &direction[entry->first], entry->count);
+        }
+    }
+#endif
+}
+
+#ifdef USE_GPIO_THREAD_SAFE
+/**
+ * @brief Asigna un puerto al núcleo que ejecuta la función.
+ *
+ * El dueño se registra con una comparación e intercambio atómico, por lo que si dos núcleos
+ * reclaman el mismo puerto a la vez solo uno lo obtiene.
+ *
+ * @param port Puerto que se desea reclamar.
+ * @return bool true si el puerto quedó asignado al núcleo, también si ya lo estaba.
+ */
+bool gpioPortClaim(gpio_port_t port) {
+    uint8_t owner = 0;
+    uint8_t core = hal_cpu_id() + 1;
+
+    if (port >= GPIO_PORTS) {
+        return false;
+    }
+    return __atomic_compare_exchange_n(&port_owners[port], &owner, core, false, __ATOMIC_ACQ_REL,
+                                       __ATOMIC_ACQUIRE) ||
+           owner == core;
+}
+
+/**
+ * @brief Libera un puerto asignado al núcleo que ejecuta la función.
+ *
+ * @param port Puerto que se desea liberar.
+ */
+void gpioPortRelease(gpio_port_t port) {
+    uint8_t owner = hal_cpu_id() + 1;
+
+    if (port < GPIO_PORTS) {
+        __atomic_compare_exchange_n(&port_owners[port], &owner, 0, false, __ATOMIC_RELEASE,
+                                    __ATOMIC_RELAXED);
+    }
+}
+#endif
+
+#ifdef USE_WRITE_ELISION
+/**
+ * @brief Obtiene la cantidad de escrituras omitidas.
+ *
+ * @return uint32_t Escrituras de salidas y cambios de dirección omitidos desde el arranque.
+ */
+uint32_t gpioElidedWrites(void) {
+    return elided_writes;
+}
+#endif
+
+#ifdef USE_GPIO_STATS
+/**
+ * @brief Copia las estadísticas de acceso de los puertos.
+ *
+ * Los contadores se copian puerto por puerto, de forma que cada copia es coherente aunque un
+ * acceso desde una interrupción puede quedar contado en un puerto y no en otro.
+ *
+ * @param snapshot Arreglo donde se copian las estadísticas, una posición por puerto.
+ * @param count Cantidad de posiciones del arreglo.
+ * @return size_t Cantidad de puertos copiados.
+ */
+size_t gpioStatsSnapshot(gpio_stats_t * snapshot, size_t count) {
+    if (count > GPIO_PORTS) {
+        count = GPIO_PORTS;
+    }
+    memcpy(snapshot, stats, count * sizeof(gpio_stats_t));
+    return count;
+}
+
+/**
+ * @brief Pone en cero las estadísticas de acceso de todos los puertos.
+ */
+void gpioStatsReset(void) {
+    memset(stats, 0, sizeof(stats));
+}
+#endif
 
 /* === End of documentation ==================================================================== */
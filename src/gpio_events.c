@@ -0,0 +1,142 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file gpio_events.c
+ * @brief Implementación de la cola de eventos de flanco de los GPIO.
+ *
+ * La cola utiliza índices de escritura y lectura que solo avanzan y que son modificados cada uno
+ * por un único contexto. La sincronización se resuelve con accesos atómicos con semántica de
+ * adquisición y liberación, sin deshabilitar interrupciones.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_events.h" /**< Declaraciones de la cola de eventos de flanco. */
+#include <stdatomic.h> /**< Biblioteca estándar para accesos atómicos. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y el contador de tiempo. */
+
+/* === Macros definitions ====================================================================== */
+
+_Static_assert((GPIO_EVENTS_SIZE & (GPIO_EVENTS_SIZE - 1)) == 0,
+               "GPIO_EVENTS_SIZE debe ser una potencia de dos");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Almacenamiento de la cola circular de eventos. */
+static gpio_event_t events[GPIO_EVENTS_SIZE];
+
+/** Cantidad total de eventos escritos, solo la modifica el productor. */
+static atomic_uint events_head = 0;
+
+/** Cantidad total de eventos leídos, solo la modifica el consumidor. */
+static atomic_uint events_tail = 0;
+
+/** Cantidad de eventos descartados por falta de espacio, solo la modifica el productor. */
+static atomic_uint events_dropped = 0;
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Registra los flancos de un GPIO en la cola de eventos.
+ *
+ * @param gpio Objeto gpio_t cuyo pin se desea observar.
+ * @param edge Flancos que se desean registrar.
+ * @return bool true si la notificación se configuró, false si la instancia ya fue destruida, si el
+ * pin es virtual o si la HAL no puede observarlo.
+ */
+bool gpioEventsWatch(gpio_t gpio, gpio_edge_t edge) {
+    return gpioOnEdge(gpio, edge, gpioEventsRecord, NULL);
+}
+
+/**
+ * @brief Agrega un evento a la cola.
+ *
+ * El evento se escribe en la posición libre antes de publicar el nuevo índice de escritura, de
+ * manera que el consumidor nunca observa un registro incompleto.
+ *
+ * @param gpio Objeto gpio_t que generó el evento.
+ * @param level Estado del pin en el momento del evento.
+ * @param context No se utiliza.
+ */
+void gpioEventsRecord(gpio_t gpio, bool level, void * context) {
+    unsigned int head = atomic_load_explicit(&events_head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&events_tail, memory_order_acquire);
+
+    (void)context;
+    if (head - tail >= GPIO_EVENTS_SIZE) {
+        /* La cola está llena, el evento se descarta */
+        unsigned int dropped = atomic_load_explicit(&events_dropped, memory_order_relaxed);
+        atomic_store_explicit(&events_dropped, dropped + 1, memory_order_relaxed);
+        return;
+    }
+
+    gpio_event_t * event = &events[head % GPIO_EVENTS_SIZE];
+    event->id = gpioGetId(gpio);
+    event->level = level;
+    event->timestamp = hal_timestamp();
+    atomic_store_explicit(&events_head, head + 1, memory_order_release); /**< Publica el evento. */
+}
+
+/**
+ * @brief Retira de la cola los eventos pendientes.
+ *
+ * @param buffer Arreglo donde se copian los eventos.
+ * @param max Cantidad máxima de eventos que se pueden copiar en el arreglo.
+ * @return size_t Cantidad de eventos copiados.
+ */
+size_t gpioEventsDrain(gpio_event_t * buffer, size_t max) {
+    unsigned int tail = atomic_load_explicit(&events_tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&events_head, memory_order_acquire);
+    size_t count = head - tail;
+
+    if (count > max) {
+        count = max;
+    }
+    for (size_t index = 0; index < count; index++) {
+        buffer[index] = events[(tail + index) % GPIO_EVENTS_SIZE];
+    }
+    atomic_store_explicit(&events_tail, tail + count, memory_order_release); /**< Libera espacio. */
+    return count;
+}
+
+/**
+ * @brief Obtiene la cantidad de eventos descartados porque la cola estaba llena.
+ *
+ * @return uint32_t Cantidad de eventos perdidos.
+ */
+uint32_t gpioEventsDropped(void) {
+    return atomic_load_explicit(&events_dropped, memory_order_relaxed);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,239 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file gpio_group.c
+ * @brief Implementación de los grupos de pines GPIO.
+ *
+ * Dentro de cada puerto, los pines del grupo se separan en tramos según el desplazamiento entre la
+ * posición del bit en el valor del grupo y su posición en el puerto. Todos los pines de un tramo
+ * se mueven con un único desplazamiento y una máscara: un campo de bits contiguo en el mismo
+ * orden ocupa un solo tramo, y una permutación arbitraria requiere como máximo un tramo por pin.
+ * Así se obtiene el efecto de las instrucciones de dispersión y recolección de bits (PDEP y PEXT)
+ * en núcleos que no las tienen.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_group.h" /**< Declaraciones de los grupos de pines. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y define los puertos. */
+#include "gpio_backend.h" /**< Cantidad total de puertos, incluidos los virtuales. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef GPIO_GROUP_MAX_INSTANCES
+#define GPIO_GROUP_MAX_INSTANCES 4 /**< Número máximo de grupos que pueden ser creados. */
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Tramo de pines de un puerto que se mueven con el mismo desplazamiento.
+ */
+struct gpio_group_run_s {
+    int8_t shift;  /**< Posición en el puerto menos posición en el valor del grupo. */
+    uint32_t mask; /**< Pines del tramo, en las posiciones del puerto. */
+};
+
+/**
+ * @brief Pines de un grupo que pertenecen a un mismo puerto.
+ */
+struct gpio_group_port_s {
+    uint8_t port;  /**< Puerto de los pines. */
+    uint8_t first; /**< Primer tramo del puerto en el arreglo de tramos del grupo. */
+    uint8_t runs;  /**< Cantidad de tramos del puerto. */
+    uint32_t mask; /**< Pines del grupo en el puerto. */
+};
+
+/**
+ * @brief Estructura que representa un grupo de pines.
+ */
+struct gpio_group_s {
+    uint8_t width;                                     /**< Cantidad de pines del grupo. */
+    uint8_t ports_count;                               /**< Cantidad de puertos del grupo. */
+    struct gpio_group_port_s ports[GPIO_PORTS];        /**< Puertos involucrados. */
+    struct gpio_group_run_s runs[GPIO_GROUP_MAX_PINS]; /**< Tramos, agrupados por puerto. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Desplaza un valor a la izquierda o, con un desplazamiento negativo, a la derecha.
+ *
+ * @param value Valor que se desplaza.
+ * @param shift Cantidad de posiciones hacia la izquierda.
+ * @return uint32_t Valor desplazado.
+ */
+static inline uint32_t shiftBits(uint32_t value, int8_t shift);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Arreglo estático que almacena los grupos. */
+static struct gpio_group_s instances[GPIO_GROUP_MAX_INSTANCES] = {0};
+
+/** Cantidad de grupos ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+static inline uint32_t shiftBits(uint32_t value, int8_t shift) {
+    return shift >= 0 ? value << shift : value >> -shift;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un grupo a partir de una lista de objetos GPIO.
+ *
+ * Los puertos se registran en el orden en que aparecen en la lista. Para cada uno se recorre la
+ * lista agregando sus pines al tramo que tiene el mismo desplazamiento, o a uno nuevo si no
+ * existe, de forma que los tramos de un puerto quedan contiguos en el arreglo.
+ *
+ * Antes de reservar el grupo se verifica que ningún objeto de la lista sea NULL y que ningún pin
+ * aparezca más de una vez, ya que un pin repetido quedaría en dos bits del valor del grupo.
+ *
+ * @param pins Lista de objetos GPIO; el primero corresponde al bit 0 del valor del grupo.
+ * @param count Cantidad de objetos de la lista.
+ * @return gpio_group_t Grupo creado o NULL si la lista no es válida o no hay grupos disponibles.
+ */
+gpio_group_t gpioGroupCreate(const gpio_t * pins, size_t count) {
+    uint32_t used[GPIO_PORTS] = {0};
+    uint32_t pending = 0;
+    uint8_t runs_count = 0;
+
+    if (pins == NULL || count == 0 || count > GPIO_GROUP_MAX_PINS ||
+        instances_used >= GPIO_GROUP_MAX_INSTANCES) {
+        return NULL;
+    }
+    for (size_t index = 0; index < count; index++) {
+        if (pins[index] == NULL || (used[gpioGetPort(pins[index])] & gpioGetMask(pins[index]))) {
+            return NULL; /**< Falta un objeto o el pin ya está en la lista. */
+        }
+        used[gpioGetPort(pins[index])] |= gpioGetMask(pins[index]);
+    }
+
+    gpio_group_t self = &instances[instances_used++];
+    self->width = (uint8_t)count;
+    self->ports_count = 0;
+
+    pending = (count == 32) ? UINT32_MAX : (((uint32_t)1 << count) - 1);
+    while (pending) {
+        struct gpio_group_port_s * entry = &self->ports[self->ports_count++];
+
+        entry->port = gpioGetPort(pins[__builtin_ctz(pending)]);
+        entry->first = runs_count;
+        entry->runs = 0;
+        entry->mask = 0;
+
+        for (uint32_t left = pending; left; left &= left - 1) {
+            uint8_t index = (uint8_t)__builtin_ctz(left);
+            uint32_t mask = gpioGetMask(pins[index]);
+            int8_t shift = (int8_t)(__builtin_ctz(mask) - index);
+            uint8_t run;
+
+            if (gpioGetPort(pins[index]) != entry->port) {
+                continue;
+            }
+            for (run = entry->first; run < runs_count; run++) {
+                if (self->runs[run].shift == shift) {
+                    break;
+                }
+            }
+            if (run == runs_count) {
+                self->runs[runs_count].shift = shift; /**< Primer pin con este desplazamiento. */
+                self->runs[runs_count].mask = 0;
+                runs_count++;
+                entry->runs++;
+            }
+            self->runs[run].mask |= mask;
+            entry->mask |= mask;
+            pending &= ~((uint32_t)1 << index); /**< El pin ya fue asignado a su puerto. */
+        }
+    }
+    return self;
+}
+
+/**
+ * @brief Escribe un valor en los pines de un grupo.
+ *
+ * @param self Grupo que se desea escribir.
+ * @param value Valor que se escribe.
+ */
+void gpioGroupWrite(gpio_group_t self, uint32_t value) {
+    for (uint8_t index = 0; index < self->ports_count; index++) {
+        const struct gpio_group_port_s * entry = &self->ports[index];
+        const struct gpio_group_run_s * run = &self->runs[entry->first];
+        uint32_t levels = 0;
+
+        for (uint8_t count = entry->runs; count; count--, run++) {
+            levels |= shiftBits(value, run->shift) & run->mask;
+        }
+        gpioPortWrite(entry->port, entry->mask, levels);
+    }
+}
+
+/**
+ * @brief Lee el valor de los pines de un grupo.
+ *
+ * @param self Grupo que se desea leer.
+ * @return uint32_t Estado de los pines del grupo.
+ */
+uint32_t gpioGroupRead(gpio_group_t self) {
+    uint32_t value = 0;
+
+    for (uint8_t index = 0; index < self->ports_count; index++) {
+        const struct gpio_group_port_s * entry = &self->ports[index];
+        const struct gpio_group_run_s * run = &self->runs[entry->first];
+        uint32_t levels = gpioPortRead(entry->port);
+
+        for (uint8_t count = entry->runs; count; count--, run++) {
+            value |= shiftBits(levels & run->mask, (int8_t)-run->shift);
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief Obtiene la cantidad de pines de un grupo.
+ *
+ * @param self Grupo consultado.
+ * @return uint8_t Cantidad de pines del grupo.
+ */
+uint8_t gpioGroupWidth(gpio_group_t self) {
+    return self->width;
+}
+
+/**
+ * @brief Obtiene la cantidad de grupos que todavía pueden crearse.
+ *
+ * @return uint8_t Cantidad de grupos disponibles.
+ */
+uint8_t gpioGroupAvailable(void) {
+    return GPIO_GROUP_MAX_INSTANCES - instances_used;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,208 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file gpio_stream.c
+ * @brief Implementación de la generación de formas de onda sobre un puerto GPIO.
+ *
+ * La transferencia la realiza el canal DMA de la HAL. Este archivo mantiene los datos de la
+ * transferencia en curso y, al terminar una transferencia simple, actualiza el registro sombra del
+ * puerto con la última palabra transmitida.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_stream.h" /**< Declaraciones de la generación de formas de onda. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y el canal DMA. */
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Datos de la transferencia en curso.
+ */
+struct gpio_stream_s {
+    volatile bool busy;          /**< Indica si hay una transferencia en curso. */
+    gpio_port_t port;            /**< Puerto que se escribe. */
+    uint32_t mask;               /**< Pines que controla la transferencia. */
+    uint32_t last;               /**< Última palabra de una transferencia simple. */
+    uint32_t * buffer;           /**< Área de memoria de una transferencia continua. */
+    size_t count;                /**< Cantidad de palabras de cada bloque continuo. */
+    gpio_stream_refill_t refill; /**< Función que completa cada bloque continuo. */
+    void * context;              /**< Puntero que se entrega a la función `refill`. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Atiende el fin de una transferencia simple.
+ *
+ * @param half No se utiliza.
+ * @param context No se utiliza.
+ */
+static void streamDone(uint8_t half, void * context);
+
+/**
+ * @brief Atiende el fin de cada bloque de una transferencia continua.
+ *
+ * @param half Bloque que se terminó de transmitir.
+ * @param context No se utiliza.
+ */
+static void streamRefill(uint8_t half, void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Transferencia en curso. */
+static struct gpio_stream_s stream = {0};
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Atiende el fin de una transferencia simple.
+ *
+ * La última palabra se vuelve a escribir a través de gpioPortWrite() para que el registro sombra
+ * del puerto refleje el estado en que quedaron los pines. Antes se invalidan las salidas, ya que
+ * una escritura de la aplicación durante la transferencia haría que esta se omitiera.
+ *
+ * @param half No se utiliza.
+ * @param context No se utiliza.
+ */
+static void streamDone(uint8_t half, void * context) {
+    (void)half;
+    (void)context;
+    gpioPortInvalidate(stream.port, stream.mask);
+    gpioPortWrite(stream.port, stream.mask, stream.last);
+    stream.busy = false;
+}
+
+/**
+ * @brief Atiende el fin de cada bloque de una transferencia continua.
+ *
+ * @param half Bloque que se terminó de transmitir.
+ * @param context No se utiliza.
+ */
+static void streamRefill(uint8_t half, void * context) {
+    (void)context;
+    stream.refill(&stream.buffer[half * stream.count], stream.count, stream.context);
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Transmite una forma de onda por los pines de un puerto.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Máscara con los pines que controla la forma de onda.
+ * @param words Palabras que se escriben en el puerto.
+ * @param count Cantidad de palabras.
+ * @param rate Cantidad de palabras por segundo.
+ * @return bool true si la transferencia se inició, false si ya hay otra en curso o si los
+ * argumentos no son válidos.
+ */
+bool gpioPortStream(gpio_port_t port, uint32_t mask, const uint32_t * words, size_t count,
+                    uint32_t rate) {
+    if (stream.busy || port >= HAL_GPIO_PORTS || words == NULL || count == 0 || rate == 0) {
+        return false;
+    }
+
+    stream.port = port;
+    stream.mask = mask;
+    stream.last = words[count - 1];
+    stream.busy = true;
+    if (hal_gpio_stream_start(port, mask, words, count, rate, false, streamDone, NULL)) {
+        gpioPortInvalidate(port, mask); /**< El DMA escribe sin pasar por gpio.c. */
+    } else {
+        stream.busy = false;
+    }
+    return stream.busy;
+}
+
+/**
+ * @brief Transmite una forma de onda continua generada por bloques.
+ *
+ * @param port Puerto que se desea escribir.
+ * @param mask Máscara con los pines que controla la forma de onda.
+ * @param buffer Área de memoria de `2 * count` palabras.
+ * @param count Cantidad de palabras de cada bloque.
+ * @param rate Cantidad de palabras por segundo.
+ * @param refill Función que completa cada bloque.
+ * @param context Puntero que se entrega a la función en cada llamada.
+ * @return bool true si la transferencia se inició, false si ya hay otra en curso o si los
+ * argumentos no son válidos.
+ */
+bool gpioPortStreamContinuous(gpio_port_t port, uint32_t mask, uint32_t * buffer, size_t count,
+                              uint32_t rate, gpio_stream_refill_t refill, void * context) {
+    if (stream.busy || port >= HAL_GPIO_PORTS || buffer == NULL || count == 0 || rate == 0 ||
+        refill == NULL) {
+        return false;
+    }
+
+    stream.port = port;
+    stream.mask = mask;
+    stream.buffer = buffer;
+    stream.count = count;
+    stream.refill = refill;
+    stream.context = context;
+    refill(&buffer[0], count, context); /**< Completa ambos bloques antes de comenzar. */
+    refill(&buffer[count], count, context);
+
+    stream.busy = true;
+    if (hal_gpio_stream_start(port, mask, buffer, 2 * count, rate, true, streamRefill, NULL)) {
+        gpioPortInvalidate(port, mask); /**< El DMA escribe sin pasar por gpio.c. */
+    } else {
+        stream.busy = false;
+    }
+    return stream.busy;
+}
+
+/**
+ * @brief Detiene la transferencia en curso.
+ *
+ * Los pines quedan en el estado de la última palabra transmitida, que no se conoce de antemano: se
+ * leen del puerto y se vuelven a escribir a través de gpioPortWrite() para que el registro sombra
+ * refleje ese estado.
+ */
+void gpioPortStreamStop(void) {
+    if (stream.busy) {
+        hal_gpio_stream_stop();
+        gpioPortInvalidate(stream.port, stream.mask);
+        gpioPortWrite(stream.port, stream.mask, gpioPortRead(stream.port));
+        stream.busy = false;
+    }
+}
+
+/**
+ * @brief Indica si hay una transferencia en curso.
+ *
+ * @return bool true si hay una transferencia en curso.
+ */
+bool gpioPortStreamBusy(void) {
+    return stream.busy;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,494 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file gpio_timer.c
+ * @brief Implementación del planificador de acciones temporizadas.
+ *
+ * La rueda tiene GPIO_TIMER_SLOTS posiciones, cada una con una lista doblemente enlazada de las
+ * acciones que vencen cuando el contador de interrupciones pasa por ella. Las acciones con un
+ * tiempo mayor que una vuelta llevan la cantidad de vueltas que faltan. Solo la interrupción del
+ * temporizador modifica la rueda: la aplicación le envía los pedidos por una cola y la
+ * interrupción le devuelve las acciones terminadas por otra, ambas con un único productor y un
+ * único consumidor.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_timer.h" /**< Declaraciones del planificador de acciones temporizadas. */
+#include <stddef.h> /**< Biblioteca estándar que define los macros para NULL y tamaños. */
+#include <stdatomic.h> /**< Biblioteca estándar para accesos atómicos. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y los temporizadores. */
+#include "gpio_backend.h" /**< Puertos virtuales, que se envían en cada interrupción. */
+
+/* === Macros definitions ====================================================================== */
+
+_Static_assert((GPIO_TIMER_MAX_ACTIONS & (GPIO_TIMER_MAX_ACTIONS - 1)) == 0 &&
+                   GPIO_TIMER_MAX_ACTIONS <= 128,
+               "GPIO_TIMER_MAX_ACTIONS debe ser una potencia de dos hasta 128");
+_Static_assert((GPIO_TIMER_SLOTS & (GPIO_TIMER_SLOTS - 1)) == 0,
+               "GPIO_TIMER_SLOTS debe ser una potencia de dos");
+
+/** Capacidad de la cola de pedidos: una alta por acción y otras tantas cancelaciones. */
+#define GPIO_TIMER_COMMANDS (2 * GPIO_TIMER_MAX_ACTIONS)
+
+#define GPIO_TIMER_NONE 0xFF /**< Índice que indica el final de una lista. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Acción temporizada sobre un pin.
+ */
+struct gpio_timer_action_s {
+    uint32_t delays[2]; /**< Tiempo hasta la siguiente escritura después de escribir 0 o 1. */
+    uint32_t delay;     /**< Tiempo hasta la primera escritura. */
+    uint32_t rounds;    /**< Vueltas de la rueda que faltan para el vencimiento. */
+    uint32_t mask;      /**< Máscara del pin en su puerto. */
+    uint32_t slot;      /**< Posición de la rueda en la que está la acción. */
+    uint8_t port;       /**< Puerto del pin. */
+    bool state;         /**< Estado que se escribe en el próximo vencimiento. */
+    bool linked;        /**< Indica si la acción está en la rueda. */
+    uint8_t generation; /**< Generación de la acción, incluida en su identificador. */
+    uint8_t next;       /**< Siguiente acción de la misma posición de la rueda. */
+    uint8_t previous;   /**< Acción anterior de la misma posición de la rueda. */
+};
+
+/**
+ * @brief Pedido de la aplicación a la interrupción del temporizador.
+ */
+struct gpio_timer_command_s {
+    gpio_action_t action; /**< Acción a la que se refiere el pedido. */
+    bool cancel;          /**< true para cancelar la acción, false para agregarla a la rueda. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Agrega una acción al comienzo de la lista de la posición en la que vence.
+ *
+ * @param index Índice de la acción.
+ * @param delay Tiempo hasta el vencimiento, al menos una interrupción.
+ * @param pending true si la posición actual todavía no se recorrió en esta interrupción.
+ */
+static void linkAction(uint8_t index, uint32_t delay, bool pending);
+
+/**
+ * @brief Quita una acción de la rueda.
+ *
+ * @param index Índice de la acción.
+ */
+static void unlinkAction(uint8_t index);
+
+/**
+ * @brief Devuelve una acción terminada a la aplicación.
+ *
+ * @param index Índice de la acción.
+ */
+static void releaseAction(uint8_t index);
+
+/**
+ * @brief Aplica los pedidos pendientes de la aplicación.
+ */
+static void drainCommands(void);
+
+/**
+ * @brief Envía un pedido a la interrupción del temporizador.
+ *
+ * @param action Acción a la que se refiere el pedido.
+ * @param cancel true para cancelar la acción, false para agregarla a la rueda.
+ * @return bool true si el pedido se registró, false si la cola está llena.
+ */
+static bool sendCommand(gpio_action_t action, bool cancel);
+
+/**
+ * @brief Crea una acción y la envía a la interrupción del temporizador.
+ *
+ * @param gpio Pin sobre el que actúa la acción.
+ * @param state Estado que se escribe en el primer vencimiento.
+ * @param delay Tiempo hasta el primer vencimiento.
+ * @param on Tiempo en alto en un parpadeo o cero.
+ * @param off Tiempo en bajo en un parpadeo o cero.
+ * @param raise true para poner el pin en alto antes de enviar el pedido.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+static gpio_action_t createAction(gpio_t gpio, bool state, uint32_t delay, uint32_t on,
+                                  uint32_t off, bool raise);
+
+/**
+ * @brief Atiende la interrupción del temporizador del planificador.
+ *
+ * @param context No se utiliza.
+ * @return uint32_t Cantidad de cuentas hasta la próxima interrupción.
+ */
+static uint32_t timerHandler(void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Acciones del planificador. */
+static struct gpio_timer_action_s actions[GPIO_TIMER_MAX_ACTIONS] = {0};
+
+/** Primera acción de cada posición de la rueda. */
+static uint8_t slots[GPIO_TIMER_SLOTS] = {0};
+
+/** Cantidad de interrupciones atendidas desde el inicio. */
+static uint32_t now = 0;
+
+/** Temporizador de hardware utilizado. */
+static uint8_t timer_used = 0;
+
+/** Indica si el planificador está en marcha. */
+static bool running = false;
+
+/** Cola de pedidos de la aplicación. */
+static struct gpio_timer_command_s commands[GPIO_TIMER_COMMANDS] = {0};
+
+/** Índice de escritura de la cola de pedidos, modificado por la aplicación. */
+static atomic_uint commands_head = 0;
+
+/** Índice de lectura de la cola de pedidos, modificado por la interrupción. */
+static atomic_uint commands_tail = 0;
+
+/** Cola de acciones libres. */
+static uint8_t released[GPIO_TIMER_MAX_ACTIONS] = {0};
+
+/** Índice de escritura de la cola de acciones libres, modificado por la interrupción. */
+static atomic_uint released_head = 0;
+
+/** Índice de lectura de la cola de acciones libres, modificado por la aplicación. */
+static atomic_uint released_tail = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Agrega una acción al comienzo de la lista de la posición en la que vence.
+ *
+ * Al agregarla al comienzo, una acción que se reprograma en la misma posición que se está
+ * recorriendo no se vuelve a visitar en la misma interrupción. Si la posición actual todavía no se
+ * recorrió, una demora múltiplo de la cantidad de posiciones cae en ella y la visita de esta misma
+ * interrupción debe contarse como una vuelta más.
+ *
+ * @param index Índice de la acción.
+ * @param delay Tiempo hasta el vencimiento, al menos una interrupción.
+ * @param pending true si la posición actual todavía no se recorrió en esta interrupción.
+ */
+static void linkAction(uint8_t index, uint32_t delay, bool pending) {
+    struct gpio_timer_action_s * action = &actions[index];
+    uint8_t * slot = &slots[(now + delay) % GPIO_TIMER_SLOTS];
+
+    action->slot = (now + delay) % GPIO_TIMER_SLOTS;
+    action->rounds = (pending ? delay : delay - 1) / GPIO_TIMER_SLOTS;
+    action->previous = GPIO_TIMER_NONE;
+    action->next = *slot;
+    if (*slot != GPIO_TIMER_NONE) {
+        actions[*slot].previous = index;
+    }
+    *slot = index;
+    action->linked = true;
+}
+
+/**
+ * @brief Quita una acción de la rueda.
+ *
+ * @param index Índice de la acción.
+ */
+static void unlinkAction(uint8_t index) {
+    struct gpio_timer_action_s * action = &actions[index];
+
+    if (action->previous != GPIO_TIMER_NONE) {
+        actions[action->previous].next = action->next;
+    } else {
+        slots[action->slot] = action->next;
+    }
+    if (action->next != GPIO_TIMER_NONE) {
+        actions[action->next].previous = action->previous;
+    }
+    action->linked = false;
+}
+
+/**
+ * @brief Devuelve una acción terminada a la aplicación.
+ *
+ * La cola tiene lugar para todas las acciones, por lo que nunca se llena.
+ *
+ * @param index Índice de la acción.
+ */
+static void releaseAction(uint8_t index) {
+    unsigned int head = atomic_load_explicit(&released_head, memory_order_relaxed);
+
+    released[head % GPIO_TIMER_MAX_ACTIONS] = index;
+    atomic_store_explicit(&released_head, head + 1, memory_order_release);
+}
+
+/**
+ * @brief Aplica los pedidos pendientes de la aplicación.
+ *
+ * Una cancelación solo se aplica si la acción sigue en la rueda y su generación coincide con la
+ * del identificador, de lo contrario la acción ya terminó.
+ */
+static void drainCommands(void) {
+    unsigned int tail = atomic_load_explicit(&commands_tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&commands_head, memory_order_acquire);
+
+    for (; tail != head; tail++) {
+        struct gpio_timer_command_s * command = &commands[tail % GPIO_TIMER_COMMANDS];
+        uint8_t index = (uint8_t)(command->action & 0xFF) - 1;
+        struct gpio_timer_action_s * action = &actions[index];
+
+        if (!command->cancel) {
+            linkAction(index, action->delay, true);
+        } else if (action->linked && action->generation == (command->action >> 8)) {
+            unlinkAction(index);
+            releaseAction(index);
+        }
+    }
+    atomic_store_explicit(&commands_tail, tail, memory_order_release);
+}
+
+/**
+ * @brief Envía un pedido a la interrupción del temporizador.
+ *
+ * @param action Acción a la que se refiere el pedido.
+ * @param cancel true para cancelar la acción, false para agregarla a la rueda.
+ * @return bool true si el pedido se registró, false si la cola está llena.
+ */
+static bool sendCommand(gpio_action_t action, bool cancel) {
+    unsigned int head = atomic_load_explicit(&commands_head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&commands_tail, memory_order_acquire);
+
+    if (head - tail >= GPIO_TIMER_COMMANDS) {
+        return false;
+    }
+    struct gpio_timer_command_s * command = &commands[head % GPIO_TIMER_COMMANDS];
+    command->action = action;
+    command->cancel = cancel;
+    atomic_store_explicit(&commands_head, head + 1, memory_order_release); /**< Publica. */
+    return true;
+}
+
+/**
+ * @brief Crea una acción y la envía a la interrupción del temporizador.
+ *
+ * La acción se toma de la cola de acciones libres solo si hay lugar para el pedido, ya que la
+ * aplicación no puede devolverla a esa cola.
+ *
+ * @param gpio Pin sobre el que actúa la acción.
+ * @param state Estado que se escribe en el primer vencimiento.
+ * @param delay Tiempo hasta el primer vencimiento.
+ * @param on Tiempo en alto en un parpadeo o cero.
+ * @param off Tiempo en bajo en un parpadeo o cero.
+ * @param raise true para poner el pin en alto antes de enviar el pedido.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+static gpio_action_t createAction(gpio_t gpio, bool state, uint32_t delay, uint32_t on,
+                                  uint32_t off, bool raise) {
+    unsigned int tail = atomic_load_explicit(&released_tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&released_head, memory_order_acquire);
+    unsigned int pending = atomic_load_explicit(&commands_head, memory_order_relaxed) -
+                           atomic_load_explicit(&commands_tail, memory_order_acquire);
+
+    if (!running || gpio == NULL || delay == 0) {
+        return GPIO_ACTION_NONE;
+    }
+    if (tail == head || pending >= GPIO_TIMER_COMMANDS) {
+        return GPIO_ACTION_NONE;
+    }
+
+    uint8_t index = released[tail % GPIO_TIMER_MAX_ACTIONS];
+    struct gpio_timer_action_s * action = &actions[index];
+    atomic_store_explicit(&released_tail, tail + 1, memory_order_release);
+
+    action->port = gpioGetPort(gpio);
+    action->mask = gpioGetMask(gpio);
+    action->state = state;
+    action->delay = delay;
+    action->delays[0] = off;
+    action->delays[1] = on;
+    action->generation++;
+
+    gpio_action_t id = (gpio_action_t)(action->generation << 8 | (index + 1));
+    if (raise) {
+        gpioSetState(gpio, true); /**< El pin cambia antes de que empiece a contar la acción. */
+    }
+    sendCommand(id, false);
+    return id;
+}
+
+/**
+ * @brief Atiende la interrupción del temporizador del planificador.
+ *
+ * Las acciones que vencen en la posición actual se acumulan por puerto y se escriben al final con
+ * una única escritura enmascarada por puerto. Un parpadeo se vuelve a agregar a la rueda con el
+ * tiempo que corresponde al estado recién escrito. Con puertos virtuales, al final se envían los
+ * puertos pendientes, por lo que las transferencias de los expansores ocurren en la interrupción.
+ *
+ * @param context No se utiliza.
+ * @return uint32_t Cantidad de cuentas hasta la próxima interrupción.
+ */
+static uint32_t timerHandler(void * context) {
+    uint32_t masks[GPIO_PORTS] = {0};
+    uint32_t values[GPIO_PORTS] = {0};
+    uint32_t ports = 0;
+
+    (void)context;
+    now++;
+    drainCommands();
+
+    uint8_t index = slots[now % GPIO_TIMER_SLOTS];
+    while (index != GPIO_TIMER_NONE) {
+        struct gpio_timer_action_s * action = &actions[index];
+        uint8_t next = action->next;
+
+        if (action->rounds > 0) {
+            action->rounds--;
+        } else {
+            masks[action->port] |= action->mask;
+            if (action->state) {
+                values[action->port] |= action->mask;
+            } else {
+                values[action->port] &= ~action->mask;
+            }
+            ports |= 1u << action->port;
+
+            uint32_t delay = action->delays[action->state];
+            unlinkAction(index);
+            if (delay > 0) {
+                action->state = !action->state;
+                linkAction(index, delay, false);
+            } else {
+                releaseAction(index);
+            }
+        }
+        index = next;
+    }
+
+    while (ports) {
+        uint8_t port = (uint8_t)__builtin_ctz(ports);
+
+        ports &= ports - 1;
+        gpioPortWrite(port, masks[port], values[port]);
+    }
+#if GPIO_VIRTUAL_PORTS > 0
+    gpioFlush(); /**< Las acciones sobre puertos virtuales se envían en la misma interrupción. */
+#endif
+    return 1;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Inicia el planificador de acciones temporizadas.
+ *
+ * Todas las acciones se colocan en la cola de acciones libres antes de iniciar el temporizador.
+ *
+ * @param timer Temporizador de hardware que utiliza el planificador.
+ * @param frequency Cantidad de interrupciones por segundo, que define la resolución de los tiempos.
+ */
+void gpioTimerStart(uint8_t timer, uint32_t frequency) {
+    gpioTimerStop();
+
+    now = 0;
+    for (uint32_t slot = 0; slot < GPIO_TIMER_SLOTS; slot++) {
+        slots[slot] = GPIO_TIMER_NONE;
+    }
+    for (uint8_t index = 0; index < GPIO_TIMER_MAX_ACTIONS; index++) {
+        actions[index].linked = false;
+        released[index] = index;
+    }
+    atomic_store(&released_tail, 0);
+    atomic_store(&released_head, GPIO_TIMER_MAX_ACTIONS);
+    atomic_store(&commands_tail, 0);
+    atomic_store(&commands_head, 0);
+
+    timer_used = timer;
+    running = true;
+    hal_timer_start(timer, frequency, 1, timerHandler, NULL);
+}
+
+/**
+ * @brief Detiene el planificador y descarta las acciones pendientes.
+ */
+void gpioTimerStop(void) {
+    if (running) {
+        hal_timer_stop(timer_used);
+        running = false;
+    }
+}
+
+/**
+ * @brief Genera un pulso en alto en un pin.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param width Duración del pulso en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioPulse(gpio_t gpio, uint32_t width) {
+    return createAction(gpio, false, width, 0, 0, true);
+}
+
+/**
+ * @brief Hace parpadear un pin hasta que se cancele la acción.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param on Tiempo en alto en interrupciones del temporizador, al menos una.
+ * @param off Tiempo en bajo en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioBlink(gpio_t gpio, uint32_t on, uint32_t off) {
+    if (on == 0 || off == 0) {
+        return GPIO_ACTION_NONE;
+    }
+    return createAction(gpio, false, on, on, off, true);
+}
+
+/**
+ * @brief Cambia el estado de un pin cuando transcurre un tiempo.
+ *
+ * @param gpio Objeto gpio_t configurado como salida.
+ * @param state Estado que se escribe en el pin.
+ * @param delay Tiempo de espera en interrupciones del temporizador, al menos una.
+ * @return gpio_action_t Acción creada o GPIO_ACTION_NONE si no hay recursos disponibles.
+ */
+gpio_action_t gpioSetStateAfter(gpio_t gpio, bool state, uint32_t delay) {
+    return createAction(gpio, state, delay, 0, 0, false);
+}
+
+/**
+ * @brief Cancela una acción pendiente.
+ *
+ * @param action Acción que se desea cancelar.
+ * @return bool true si el pedido se registró, false si la cola de pedidos está llena.
+ */
+bool gpioCancel(gpio_action_t action) {
+    uint8_t index = (uint8_t)(action & 0xFF);
+
+    if (!running || index == 0 || index > GPIO_TIMER_MAX_ACTIONS) {
+        return false;
+    }
+    return sendCommand(action, true);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,207 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file gpio_trace.c
+ * @brief Implementación del registro de la actividad de los GPIO.
+ *
+ * Los registros se codifican directamente sobre la cola circular de bytes, cuyo índice de
+ * escritura solo se publica al completar el registro. Como los productores pueden ser el lazo
+ * principal y las interrupciones, la codificación y la actualización de los últimos valores se
+ * realizan dentro de una sección crítica. El consumidor solo modifica el índice de lectura.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_trace.h" /**< Declaraciones del registro de actividad. */
+#include <stdatomic.h> /**< Biblioteca estándar para accesos atómicos. */
+#include <string.h> /**< Biblioteca estándar para el manejo de memoria. */
+#include "gpio_backend.h" /**< Cantidad total de puertos, incluidos los virtuales. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y el contador de tiempo. */
+
+/* === Macros definitions ====================================================================== */
+
+/** Longitud máxima de un registro con valor precedido por uno de sincronización. */
+#define GPIO_TRACE_RECORD_MAX (1 + 5 + 1 + 5 + 5)
+
+_Static_assert((GPIO_TRACE_SIZE & (GPIO_TRACE_SIZE - 1)) == 0,
+               "GPIO_TRACE_SIZE debe ser una potencia de dos");
+_Static_assert(GPIO_TRACE_SIZE >= GPIO_TRACE_RECORD_MAX, "GPIO_TRACE_SIZE es demasiado chico");
+_Static_assert(GPIO_PORTS <= 32, "El formato del registro admite hasta 32 puertos");
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Escribe un entero de longitud variable en la cola.
+ *
+ * @param head Posición de la cola donde comienza el entero.
+ * @param value Valor que se desea escribir.
+ * @return unsigned int Posición siguiente al último byte escrito.
+ */
+static unsigned int putVarint(unsigned int head, uint32_t value);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Almacenamiento de la cola circular de bytes. */
+static uint8_t trace[GPIO_TRACE_SIZE];
+
+/** Cantidad total de bytes escritos, solo se modifica dentro de la sección crítica. */
+static atomic_uint trace_head = 0;
+
+/** Cantidad total de bytes leídos, solo la modifica el consumidor. */
+static atomic_uint trace_tail = 0;
+
+/** Cantidad de registros descartados por falta de espacio. */
+static atomic_uint trace_dropped = 0;
+
+/** Indica si el registro de actividad está habilitado. */
+static atomic_bool trace_enabled = false;
+
+/** Indica que el próximo registro debe precederse por uno de sincronización. */
+static bool trace_sync = true;
+
+/** Instante del último registro escrito. */
+static uint32_t last_time;
+
+/** Último valor registrado de cada tipo y puerto. */
+static uint32_t last_values[GPIO_TRACE_KINDS][GPIO_PORTS];
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Escribe un entero de longitud variable en la cola.
+ *
+ * Cada byte contiene siete bits del valor, comenzando por los menos significativos, y tiene el bit
+ * más significativo en uno si el valor continúa en el byte siguiente.
+ *
+ * @param head Posición de la cola donde comienza el entero.
+ * @param value Valor que se desea escribir.
+ * @return unsigned int Posición siguiente al último byte escrito.
+ */
+static unsigned int putVarint(unsigned int head, uint32_t value) {
+    while (value >= 0x80) {
+        trace[head++ % GPIO_TRACE_SIZE] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    trace[head++ % GPIO_TRACE_SIZE] = (uint8_t)value;
+    return head;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Habilita o deshabilita el registro de actividad.
+ *
+ * @param enable true para registrar la actividad, false para dejar de hacerlo.
+ */
+void gpioTraceEnable(bool enable) {
+    uint32_t state = hal_irq_lock();
+
+    trace_sync = true;
+    atomic_store_explicit(&trace_enabled, enable, memory_order_relaxed);
+    hal_irq_unlock(state);
+}
+
+/**
+ * @brief Agrega un registro a la cola.
+ *
+ * El espacio se verifica para el caso de mayor longitud antes de codificar, por lo que el registro
+ * se escribe completo o se descarta sin modificar la referencia de la codificación.
+ *
+ * @param kind Tipo de registro.
+ * @param port Número de puerto.
+ * @param value Estado de los pines del puerto.
+ */
+void gpioTraceRecord(uint8_t kind, uint8_t port, uint32_t value) {
+    if (!atomic_load_explicit(&trace_enabled, memory_order_relaxed)) {
+        return;
+    }
+
+    uint32_t state = hal_irq_lock();
+    uint32_t now = hal_timestamp(); /**< Se lee en la sección crítica para mantener el orden. */
+    unsigned int head = atomic_load_explicit(&trace_head, memory_order_relaxed);
+    unsigned int tail = atomic_load_explicit(&trace_tail, memory_order_acquire);
+
+    if (GPIO_TRACE_SIZE - (head - tail) < GPIO_TRACE_RECORD_MAX) {
+        /* La cola está llena, el flujo debe volver a sincronizarse al retomar */
+        unsigned int dropped = atomic_load_explicit(&trace_dropped, memory_order_relaxed);
+        atomic_store_explicit(&trace_dropped, dropped + 1, memory_order_relaxed);
+        trace_sync = true;
+        hal_irq_unlock(state);
+        return;
+    }
+
+    if (trace_sync) {
+        trace[head++ % GPIO_TRACE_SIZE] = GPIO_TRACE_SYNC << 5;
+        head = putVarint(head, hal_timestamp_frequency());
+        memset(last_values, 0, sizeof(last_values));
+        last_time = 0;
+        trace_sync = false;
+    }
+    trace[head++ % GPIO_TRACE_SIZE] = (uint8_t)((kind << 5) | port);
+    head = putVarint(head, now - last_time);
+    head = putVarint(head, value ^ last_values[kind][port]);
+    last_time = now;
+    last_values[kind][port] = value;
+    atomic_store_explicit(&trace_head, head, memory_order_release); /**< Publica el registro. */
+    hal_irq_unlock(state);
+}
+
+/**
+ * @brief Retira de la cola los bytes registrados.
+ *
+ * @param buffer Arreglo donde se copian los bytes.
+ * @param size Cantidad máxima de bytes que se pueden copiar en el arreglo.
+ * @return size_t Cantidad de bytes copiados.
+ */
+size_t gpioTraceRead(uint8_t * buffer, size_t size) {
+    unsigned int tail = atomic_load_explicit(&trace_tail, memory_order_relaxed);
+    unsigned int head = atomic_load_explicit(&trace_head, memory_order_acquire);
+    size_t count = head - tail;
+
+    if (count > size) {
+        count = size;
+    }
+    for (size_t index = 0; index < count; index++) {
+        buffer[index] = trace[(tail + index) % GPIO_TRACE_SIZE];
+    }
+    atomic_store_explicit(&trace_tail, tail + count, memory_order_release); /**< Libera espacio. */
+    return count;
+}
+
+/**
+ * @brief Obtiene la cantidad de registros descartados porque la cola estaba llena.
+ *
+ * @return uint32_t Cantidad de registros perdidos.
+ */
+uint32_t gpioTraceDropped(void) {
+    return atomic_load_explicit(&trace_dropped, memory_order_relaxed);
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,537 @@
+/************************************************************************************************
+ * Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ *substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ *OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ ************************************************************************************************/
+/**
+ * @file hal_lpc43xx.c
+ * @brief Implementación de la HAL para el núcleo Cortex-M4 de la familia LPC43xx.
+ *
+ * Las salidas se escriben con los registros SET, CLR y NOT del controlador GPIO, que modifican
+ * solo los pines escritos en uno sin leer el puerto, por lo que cada escritura es un único acceso
+ * atómico. Los pines individuales se leen con los registros de byte, que contienen el nivel de un
+ * único pin. Las interrupciones de flanco utilizan los ocho canales del bloque PINT, que se asignan
+ * a los pines a medida que se configuran. Los temporizadores cuentan en forma libre y cada
+ * interrupción programa la siguiente sumando cuentas al registro de coincidencia, de manera que
+ * los retardos de atención no se acumulan. La transferencia hacia un puerto utiliza el canal 0 del
+ * controlador DMA, disparado por las coincidencias del temporizador `HAL_GPIO_STREAM_TIMER`, que
+ * no puede utilizarse con hal_timer_start() mientras la transferencia está activa.
+ *
+ * La configuración de las funciones de los terminales en el SCU y de los relojes queda a cargo de
+ * la aplicación. Esta implementación se selecciona con `make HAL=lpc43xx`.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "hal.h"
+
+/* === Macros definitions ====================================================================== */
+/**
+ * @defgroup HAL_MACROS Macros de HAL
+ * @{
+ */
+
+#ifndef HAL_GPIO_STREAM_TIMER
+#define HAL_GPIO_STREAM_TIMER 3 /**< Temporizador que marca el ritmo de la transferencia DMA. */
+#endif
+
+#define NVIC_ISER ((volatile uint32_t *)0xE000E100) /**< Habilitación de interrupciones. */
+
+#define DWT_CONTROL      (*(volatile uint32_t *)0xE0001000) /**< Control del DWT. */
+#define DWT_CYCLES       (*(volatile uint32_t *)0xE0001004) /**< Contador de ciclos del DWT. */
+#define DEBUG_EXCEPTIONS (*(volatile uint32_t *)0xE000EDFC) /**< Registro DEMCR del núcleo. */
+#define DWT_CYCCNTENA    (1u << 0)                          /**< Habilita el contador. */
+#define DEMCR_TRCENA     (1u << 24)                         /**< Habilita el bloque DWT. */
+
+#define SCB_CPUID     (*(volatile uint32_t *)0xE000ED00) /**< Identificación del núcleo. */
+#define CPUID_PARTNO  0x0000FFF0                         /**< Campo del modelo del núcleo. */
+#define CPUID_CORTEX4 0x0000C240                         /**< Modelo del núcleo Cortex-M4. */
+
+#define DMA_IRQ      2  /**< Interrupción del controlador DMA. */
+#define TIMER0_IRQ   12 /**< Interrupción del temporizador 0, las siguientes son consecutivas. */
+#define PIN_INT0_IRQ 32 /**< Interrupción del canal 0 del PINT, las siguientes son consecutivas. */
+
+#define TCR_ENABLE 0x01 /**< Habilita la cuenta del temporizador. */
+#define TCR_RESET  0x02 /**< Mantiene el contador en cero. */
+#define MCR_MR0I   0x01 /**< Interrumpe en la coincidencia con MR0. */
+#define MCR_MR0R   0x02 /**< Reinicia el contador en la coincidencia con MR0. */
+#define IR_MR0     0x01 /**< Interrupción pendiente de la coincidencia con MR0. */
+
+#define DMA_STREAM_CHANNEL 0      /**< Canal del controlador DMA utilizado por la transferencia. */
+#define DMA_MAX_TRANSFER   0x0FFF /**< Máxima cantidad de palabras de un bloque. */
+/** Palabras de 32 bits en origen y destino, origen incrementado e interrupción al terminar. */
+#define DMA_CONTROL_WORDS ((2u << 18) | (2u << 21) | (1u << 26) | (1u << 31))
+#define DMA_CONFIG_ENABLE (1u << 0)  /**< Habilita el canal. */
+#define DMA_CONFIG_M2P    (1u << 11) /**< Transferencia de memoria a periférico. */
+#define DMA_CONFIG_IE     (1u << 14) /**< Habilita la interrupción de error. */
+#define DMA_CONFIG_ITC    (1u << 15) /**< Habilita la interrupción de bloque completado. */
+
+/** Canal de pedidos de DMA de la coincidencia con MR0 de un temporizador. */
+#define DMA_TIMER_REQUEST(timer) (2u * (timer) + 1u)
+
+/** @} */ // end of HAL_MACROS
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @defgroup HAL_TYPES Tipos de datos privados
+ * @{
+ */
+
+/**
+ * @brief Bloque de la lista de transferencias del controlador DMA.
+ */
+struct dma_block_s {
+    uint32_t source;      /**< Dirección de origen. */
+    uint32_t destination; /**< Dirección de destino. */
+    uint32_t next;        /**< Dirección del siguiente bloque o cero. */
+    uint32_t control;     /**< Valor del registro CONTROL para este bloque. */
+};
+
+/**
+ * @brief Temporizador configurado por la aplicación.
+ */
+struct timer_s {
+    hal_timer_handler_t handler; /**< Función que atiende la interrupción. */
+    void * context;              /**< Puntero que se entrega a la función. */
+};
+
+/** @} */ // end of HAL_TYPES
+
+/* === Private variable declarations =========================================================== */
+/**
+ * @defgroup HAL_PRIVATE_VARIABLES Variables privadas
+ * @{
+ */
+
+/** Registros de cada temporizador. */
+static lpc43xx_timer_t * const timer_registers[HAL_TIMER_COUNT] = {
+    LPC43XX_TIMER0, LPC43XX_TIMER1, LPC43XX_TIMER2, LPC43XX_TIMER3};
+
+/** Temporizadores configurados. */
+static struct timer_s timers[HAL_TIMER_COUNT];
+
+/** Función que atiende las interrupciones de los pines. */
+static hal_gpio_irq_handler_t irq_handler;
+
+/** Pin asignado a cada canal del PINT, con el formato de los registros PINTSEL. */
+static uint8_t pint_pins[LPC43XX_PINT_CHANNELS];
+
+/** Canales del PINT asignados. */
+static uint8_t pint_used;
+
+/** Bloques de la transferencia DMA, dos en una transferencia circular. */
+static struct dma_block_s dma_blocks[2];
+
+/** Función que se invoca al completar cada bloque de la transferencia. */
+static hal_gpio_stream_handler_t stream_handler;
+
+/** Puntero que se entrega a la función de la transferencia. */
+static void * stream_context;
+
+/** Indica si la transferencia es circular. */
+static bool stream_circular;
+
+/** Mitad de la transferencia circular que se está transfiriendo. */
+static uint8_t stream_half;
+
+/** Puerto de la transferencia DMA en curso, o UINT8_MAX si no hay ninguna. */
+static uint8_t stream_port = UINT8_MAX;
+
+/** @} */ // end of HAL_PRIVATE_VARIABLES
+
+/* === Private function declarations =========================================================== */
+/**
+ * @defgroup HAL_PRIVATE_FUNCTIONS Funciones privadas
+ * @{
+ */
+
+/**
+ * @brief Deshabilita las interrupciones.
+ *
+ * @return uint32_t Estado previo de las interrupciones, para entregar a criticalExit().
+ */
+static inline uint32_t criticalEnter(void);
+
+/**
+ * @brief Restablece el estado de las interrupciones.
+ *
+ * @param state Valor devuelto por criticalEnter().
+ */
+static inline void criticalExit(uint32_t state);
+
+/**
+ * @brief Habilita una interrupción en el NVIC.
+ *
+ * @param irq Número de la interrupción.
+ */
+static void irqEnable(uint8_t irq);
+
+/**
+ * @brief Atiende la interrupción de un canal del PINT.
+ *
+ * @param channel Canal que generó la interrupción.
+ */
+static void pintHandler(uint8_t channel);
+
+/**
+ * @brief Atiende la interrupción de un temporizador.
+ *
+ * @param timer Temporizador que generó la interrupción.
+ */
+static void timerHandler(uint8_t timer);
+
+/** @} */ // end of HAL_PRIVATE_FUNCTIONS
+
+/* === Private function implementation ========================================================= */
+
+static inline uint32_t criticalEnter(void) {
+    uint32_t state;
+    __asm__ volatile("mrs %0, primask\n\tcpsid i" : "=r"(state)::"memory");
+    return state;
+}
+
+static inline void criticalExit(uint32_t state) {
+    __asm__ volatile("msr primask, %0" ::"r"(state) : "memory");
+}
+
+static void irqEnable(uint8_t irq) {
+    NVIC_ISER[irq / 32] = 1u << (irq % 32);
+}
+
+static void pintHandler(uint8_t channel) {
+    uint32_t mask = 1u << channel;
+    uint8_t port = pint_pins[channel] >> 5;
+
+    LPC43XX_PINT->IST = mask;
+    if (irq_handler) {
+        irq_handler(port, 1u << (pint_pins[channel] & 0x1F), LPC43XX_GPIO->PIN[port]);
+    }
+}
+
+static void timerHandler(uint8_t timer) {
+    lpc43xx_timer_t * registers = timer_registers[timer];
+    uint32_t ticks = 0;
+
+    registers->IR = IR_MR0;
+    if (timers[timer].handler) {
+        ticks = timers[timer].handler(timers[timer].context);
+    }
+    if (ticks) {
+        registers->MR[0] += ticks;
+    } else {
+        registers->TCR = 0;
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+void hal_gpio_set_direction(uint8_t port, uint8_t bit, bool output) {
+    hal_gpio_set_port_direction(port, 1u << bit, output ? UINT32_MAX : 0);
+}
+
+void hal_gpio_set_port_direction(uint8_t port, uint32_t mask, uint32_t outputs) {
+    /* El registro de dirección no tiene registros de escritura atómica */
+    uint32_t state = criticalEnter();
+    LPC43XX_GPIO->DIR[port] = (LPC43XX_GPIO->DIR[port] & ~mask) | (outputs & mask);
+    criticalExit(state);
+}
+
+void hal_gpio_set_output(uint8_t port, uint8_t bit, bool active) {
+    if (active) {
+        LPC43XX_GPIO->SET[port] = 1u << bit;
+    } else {
+        LPC43XX_GPIO->CLR[port] = 1u << bit;
+    }
+}
+
+bool hal_gpio_get_input(uint8_t port, uint8_t bit) {
+    return LPC43XX_GPIO->B[port][bit] != 0;
+}
+
+uint32_t hal_gpio_get_port(uint8_t port) {
+    return LPC43XX_GPIO->PIN[port];
+}
+
+bool hal_gpio_set_edge(uint8_t port, uint8_t bit, hal_gpio_edge_t edge) {
+    uint8_t pin = (uint8_t)((port << 5) | bit);
+    uint8_t channel;
+
+    for (channel = 0; channel < LPC43XX_PINT_CHANNELS; channel++) {
+        if ((pint_used & (1u << channel)) && pint_pins[channel] == pin) {
+            break;
+        }
+    }
+
+    if (channel == LPC43XX_PINT_CHANNELS) {
+        if (edge == HAL_GPIO_EDGE_NONE) {
+            return true;
+        }
+        if (pint_used == 0xFF) {
+            return false; /**< Los ocho canales del PINT están asignados. */
+        }
+        channel = (uint8_t)__builtin_ctz(~(uint32_t)pint_used);
+        pint_used |= 1u << channel;
+        pint_pins[channel] = pin;
+
+        uint32_t shift = 8 * (channel % 4);
+        volatile uint32_t * select = &LPC43XX_PINTSEL[channel / 4];
+        *select = (*select & ~(0xFFu << shift)) | ((uint32_t)pin << shift);
+        LPC43XX_PINT->ISEL &= ~(1u << channel);
+        irqEnable(PIN_INT0_IRQ + channel);
+    }
+
+    uint32_t mask = 1u << channel;
+    if (edge & HAL_GPIO_EDGE_RISING) {
+        LPC43XX_PINT->SIENR = mask;
+    } else {
+        LPC43XX_PINT->CIENR = mask;
+    }
+    if (edge & HAL_GPIO_EDGE_FALLING) {
+        LPC43XX_PINT->SIENF = mask;
+    } else {
+        LPC43XX_PINT->CIENF = mask;
+    }
+    if (edge == HAL_GPIO_EDGE_NONE) {
+        LPC43XX_PINT->IST = mask;
+        pint_used &= ~mask;
+    }
+    return true;
+}
+
+void hal_gpio_set_irq_handler(hal_gpio_irq_handler_t handler) {
+    irq_handler = handler;
+}
+
+void hal_gpio_set_port_mask(uint8_t port, uint32_t set, uint32_t clear) {
+    if (port == stream_port) {
+        /* El registro MASK del puerto pertenece a la transferencia DMA en curso */
+        LPC43XX_GPIO->CLR[port] = clear & ~set;
+        LPC43XX_GPIO->SET[port] = set;
+        return;
+    }
+
+    /* Una única escritura en MPIN modifica todos los pines no excluidos por MASK */
+    uint32_t state = criticalEnter();
+    uint32_t mask = LPC43XX_GPIO->MASK[port];
+    LPC43XX_GPIO->MASK[port] = ~(set | clear);
+    LPC43XX_GPIO->MPIN[port] = set;
+    LPC43XX_GPIO->MASK[port] = mask;
+    criticalExit(state);
+}
+
+void hal_gpio_toggle_port_mask(uint8_t port, uint32_t mask) {
+    LPC43XX_GPIO->NOT[port] = mask;
+}
+
+bool hal_gpio_stream_start(uint8_t port, uint32_t mask, const uint32_t * words, size_t count,
+                           uint32_t rate, bool circular, hal_gpio_stream_handler_t handler,
+                           void * context) {
+    lpc43xx_timer_t * timer = timer_registers[HAL_GPIO_STREAM_TIMER];
+    lpc43xx_gpdma_channel_t * channel = &LPC43XX_GPDMA->CH[DMA_STREAM_CHANNEL];
+    size_t block = circular ? count / 2 : count;
+    uint32_t request = DMA_TIMER_REQUEST(HAL_GPIO_STREAM_TIMER);
+
+    if ((timer->TCR & TCR_ENABLE) || (channel->CONFIG & DMA_CONFIG_ENABLE) || block == 0 ||
+        block > DMA_MAX_TRANSFER || (circular && (count % 2)) || rate == 0 ||
+        rate > HAL_CPU_FREQUENCY) {
+        return false;
+    }
+
+    stream_handler = handler;
+    stream_context = context;
+    stream_circular = circular;
+    stream_half = 0;
+    stream_port = port;
+
+    /* Las escrituras en MPIN solo modifican los pines que no están excluidos por MASK */
+    LPC43XX_GPIO->MASK[port] = ~mask;
+    for (uint8_t index = 0; index < (circular ? 2 : 1); index++) {
+        dma_blocks[index].source = (uint32_t)(uintptr_t)&words[index * block];
+        dma_blocks[index].destination = (uint32_t)(uintptr_t)&LPC43XX_GPIO->MPIN[port];
+        dma_blocks[index].control = DMA_CONTROL_WORDS | (uint32_t)block;
+        dma_blocks[index].next = circular ? (uint32_t)(uintptr_t)&dma_blocks[index ^ 1] : 0;
+    }
+
+    LPC43XX_DMAMUX &= ~(3u << (2 * request));
+    LPC43XX_GPDMA->CONFIG = 1;
+    LPC43XX_GPDMA->INTTCCLEAR = 1u << DMA_STREAM_CHANNEL;
+    LPC43XX_GPDMA->INTERRCLR = 1u << DMA_STREAM_CHANNEL;
+    channel->SRCADDR = dma_blocks[0].source;
+    channel->DESTADDR = dma_blocks[0].destination;
+    channel->LLI = dma_blocks[0].next;
+    channel->CONTROL = dma_blocks[0].control;
+    channel->CONFIG = DMA_CONFIG_ENABLE | (request << 6) | DMA_CONFIG_M2P | DMA_CONFIG_IE |
+                      DMA_CONFIG_ITC;
+    irqEnable(DMA_IRQ);
+
+    /* Cada coincidencia reinicia el temporizador y pide la transferencia de una palabra */
+    timer->TCR = TCR_RESET;
+    timer->PR = 0;
+    timer->MR[0] = HAL_CPU_FREQUENCY / rate - 1;
+    timer->MCR = MCR_MR0R;
+    timer->IR = 0x3F;
+    timer->TCR = TCR_ENABLE;
+    return true;
+}
+
+void hal_gpio_stream_stop(void) {
+    timer_registers[HAL_GPIO_STREAM_TIMER]->TCR = 0;
+    LPC43XX_GPDMA->CH[DMA_STREAM_CHANNEL].CONFIG &= ~DMA_CONFIG_ENABLE;
+    stream_port = UINT8_MAX;
+}
+
+void hal_timer_start(uint8_t timer, uint32_t frequency, uint32_t ticks, hal_timer_handler_t handler,
+                     void * context) {
+    if (timer >= HAL_TIMER_COUNT || frequency == 0 || ticks == 0) {
+        return;
+    }
+
+    lpc43xx_timer_t * registers = timer_registers[timer];
+    uint32_t prescaler = HAL_CPU_FREQUENCY / frequency;
+
+    timers[timer].handler = handler;
+    timers[timer].context = context;
+
+    /* El contador avanza libremente y cada interrupción corre la coincidencia */
+    registers->TCR = TCR_RESET;
+    registers->PR = prescaler ? prescaler - 1 : 0;
+    registers->MR[0] = ticks;
+    registers->MCR = MCR_MR0I;
+    registers->IR = 0x3F;
+    irqEnable(TIMER0_IRQ + timer);
+    registers->TCR = TCR_ENABLE;
+}
+
+void hal_timer_stop(uint8_t timer) {
+    if (timer < HAL_TIMER_COUNT) {
+        timer_registers[timer]->TCR = 0;
+        timer_registers[timer]->IR = 0x3F;
+    }
+}
+
+uint32_t hal_timestamp(void) {
+    if ((DWT_CONTROL & DWT_CYCCNTENA) == 0) {
+        DEBUG_EXCEPTIONS |= DEMCR_TRCENA;
+        DWT_CONTROL |= DWT_CYCCNTENA;
+    }
+    return DWT_CYCLES;
+}
+
+uint32_t hal_timestamp_frequency(void) {
+    return HAL_CPU_FREQUENCY;
+}
+
+void hal_cpu_sleep(void) {
+    __asm__ volatile("wfi" ::: "memory");
+}
+
+uint8_t hal_cpu_id(void) {
+    return (SCB_CPUID & CPUID_PARTNO) == CPUID_CORTEX4 ? 0 : 1; /**< El Cortex-M0 es el núcleo 1. */
+}
+
+uint32_t hal_irq_lock(void) {
+    return criticalEnter();
+}
+
+void hal_irq_unlock(uint32_t state) {
+    criticalExit(state);
+}
+
+/**
+ * @brief Rutina de interrupción del controlador DMA.
+ */
+void DMA_IRQHandler(void) {
+    uint32_t channel = 1u << DMA_STREAM_CHANNEL;
+
+    if (LPC43XX_GPDMA->INTERRSTAT & channel) {
+        LPC43XX_GPDMA->INTERRCLR = channel;
+        hal_gpio_stream_stop();
+    }
+    if (LPC43XX_GPDMA->INTTCSTAT & channel) {
+        LPC43XX_GPDMA->INTTCCLEAR = channel;
+        if (!stream_circular) {
+            timer_registers[HAL_GPIO_STREAM_TIMER]->TCR = 0;
+            stream_port = UINT8_MAX;
+        }
+        if (stream_handler) {
+            stream_handler(stream_half, stream_context);
+        }
+        stream_half ^= stream_circular;
+    }
+}
+
+/** @brief Rutina de interrupción del temporizador 0. */
+void TIMER0_IRQHandler(void) {
+    timerHandler(0);
+}
+
+/** @brief Rutina de interrupción del temporizador 1. */
+void TIMER1_IRQHandler(void) {
+    timerHandler(1);
+}
+
+/** @brief Rutina de interrupción del temporizador 2. */
+void TIMER2_IRQHandler(void) {
+    timerHandler(2);
+}
+
+/** @brief Rutina de interrupción del temporizador 3. */
+void TIMER3_IRQHandler(void) {
+    timerHandler(3);
+}
+
+/** @brief Rutina de interrupción del canal 0 del PINT. */
+void GPIO0_IRQHandler(void) {
+    pintHandler(0);
+}
+
+/** @brief Rutina de interrupción del canal 1 del PINT. */
+void GPIO1_IRQHandler(void) {
+    pintHandler(1);
+}
+
+/** @brief Rutina de interrupción del canal 2 del PINT. */
+void GPIO2_IRQHandler(void) {
+    pintHandler(2);
+}
+
+/** @brief Rutina de interrupción del canal 3 del PINT. */
+void GPIO3_IRQHandler(void) {
+    pintHandler(3);
+}
+
+/** @brief Rutina de interrupción del canal 4 del PINT. */
+void GPIO4_IRQHandler(void) {
+    pintHandler(4);
+}
+
+/** @brief Rutina de interrupción del canal 5 del PINT. */
+void GPIO5_IRQHandler(void) {
+    pintHandler(5);
+}
+
+/** @brief Rutina de interrupción del canal 6 del PINT. */
+void GPIO6_IRQHandler(void) {
+    pintHandler(6);
+}
+
+/** @brief Rutina de interrupción del canal 7 del PINT. */
+void GPIO7_IRQHandler(void) {
+    pintHandler(7);
+}
+
+/* === End of documentation ==================================================================== */
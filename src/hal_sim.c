@@ -0,0 +1,656 @@
+/************************************************************************************************
+ * Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+ * associated documentation files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge, publish, distribute,
+ * sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ *substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+ * NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ *DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+ *OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * SPDX-License-Identifier: MIT
+ ************************************************************************************************/
+/**
+ * @file hal_sim.c
+ * @brief Implementación simulada de la HAL para ejecutar la biblioteca en la computadora.
+ *
+ * Este archivo implementa todas las funciones de hal.h sobre un banco de registros en memoria con
+ * la dirección, la salida y la entrada externa de cada puerto. El tiempo es virtual: solo avanza
+ * con hal_sim_advance(), que ejecuta en orden las interrupciones de los temporizadores y las
+ * transferencias DMA programadas, por lo que las ejecuciones son deterministas. Los cambios de
+ * nivel de los pines, tanto por escritura de las salidas como por inyección de entradas, generan
+ * las interrupciones de flanco configuradas.
+ *
+ * Esta implementación se selecciona con `make HAL=sim`, que es la opción por defecto.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "hal.h"
+#include "hal_sim.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+/**
+ * @defgroup HAL_MACROS Macros de HAL
+ * @{
+ */
+
+#define NANOSECONDS 1000000000ULL /**< Cantidad de nanosegundos en un segundo. */
+
+/** @} */ // end of HAL_MACROS
+
+/* === Private data type declarations ========================================================== */
+/**
+ * @defgroup HAL_TYPES Tipos de datos privados
+ * @{
+ */
+
+/**
+ * @brief Registros simulados de un puerto GPIO.
+ */
+struct sim_port_s {
+    uint32_t direction; /**< Pines configurados como salida. */
+    uint32_t output;    /**< Valor escrito en el registro de salida. */
+    uint32_t input;     /**< Nivel aplicado externamente a los pines de entrada. */
+    uint32_t level;     /**< Nivel actual de los pines. */
+    uint32_t rising;    /**< Pines que interrumpen en el flanco ascendente. */
+    uint32_t falling;   /**< Pines que interrumpen en el flanco descendente. */
+    uint32_t pending;   /**< Interrupciones pendientes de atención. */
+};
+
+/**
+ * @brief Fuente de eventos periódicos en el tiempo virtual.
+ *
+ * El instante de cada evento se calcula a partir del instante inicial y de la cantidad acumulada
+ * de cuentas, por lo que no se acumulan errores de redondeo.
+ */
+struct sim_clock_s {
+    bool running;       /**< Indica si la fuente está activa. */
+    uint32_t frequency; /**< Frecuencia de cuenta en Hz. */
+    uint64_t start;     /**< Instante inicial, en nanosegundos. */
+    uint64_t ticks;     /**< Cuentas desde el instante inicial hasta el próximo evento. */
+};
+
+/**
+ * @brief Temporizador simulado.
+ */
+struct sim_timer_s {
+    struct sim_clock_s clock;    /**< Instante de la próxima interrupción. */
+    hal_timer_handler_t handler; /**< Función que atiende la interrupción. */
+    void * context;              /**< Puntero que se entrega a la función. */
+};
+
+/**
+ * @brief Transferencia DMA simulada hacia un puerto.
+ */
+struct sim_stream_s {
+    struct sim_clock_s clock;          /**< Instante de la próxima palabra. */
+    uint8_t port;                      /**< Puerto que se escribe. */
+    uint32_t mask;                     /**< Pines que controla la transferencia. */
+    const uint32_t * words;            /**< Palabras que se transfieren. */
+    size_t count;                      /**< Cantidad de palabras. */
+    size_t index;                      /**< Próxima palabra que se transfiere. */
+    bool circular;                     /**< Indica si la transferencia se repite. */
+    hal_gpio_stream_handler_t handler; /**< Función que se invoca al completar cada mitad. */
+    void * context;                    /**< Puntero que se entrega a la función. */
+};
+
+/** @} */ // end of HAL_TYPES
+
+/* === Private variable declarations =========================================================== */
+/**
+ * @defgroup HAL_PRIVATE_VARIABLES Variables privadas
+ * @{
+ */
+
+/** Registros simulados de cada puerto. */
+static struct sim_port_s ports[HAL_GPIO_PORTS];
+
+/** Temporizadores simulados. */
+static struct sim_timer_s timers[HAL_TIMER_COUNT];
+
+/** Transferencia DMA simulada. */
+static struct sim_stream_s stream;
+
+/** Función que atiende las interrupciones de los pines. */
+static hal_gpio_irq_handler_t irq_handler;
+
+/** Indica si se está ejecutando la función de atención de interrupciones de los pines. */
+static bool irq_active;
+
+/** Función que registra los accesos a la HAL o NULL. */
+static hal_sim_trace_t trace;
+
+/** Instante actual del tiempo virtual, en nanosegundos. */
+static uint64_t now;
+
+/** Cantidad de accesos a los registros simulados. */
+static uint32_t accesses;
+
+/** Núcleo simulado que ejecuta el código. */
+static uint8_t cpu;
+
+/** @} */ // end of HAL_PRIVATE_VARIABLES
+
+/* === Private function declarations =========================================================== */
+/**
+ * @defgroup HAL_PRIVATE_FUNCTIONS Funciones privadas
+ * @{
+ */
+
+/**
+ * @brief Informa un acceso a la HAL a la función de registro.
+ *
+ * @param kind Tipo de acceso.
+ * @param port Puerto accedido.
+ * @param mask Pines involucrados.
+ * @param value Valor escrito o leído.
+ */
+static void record(hal_sim_access_t kind, uint8_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Recalcula el nivel de los pines de un puerto y genera las interrupciones de flanco.
+ *
+ * @param port Puerto cuyos registros cambiaron.
+ */
+static void updatePort(uint8_t port);
+
+/**
+ * @brief Calcula el instante del próximo evento de una fuente periódica.
+ *
+ * @param clock Fuente consultada.
+ * @return uint64_t Instante del próximo evento, en nanosegundos.
+ */
+static uint64_t clockNext(const struct sim_clock_s * clock);
+
+/**
+ * @brief Transfiere la próxima palabra de la transferencia DMA simulada.
+ */
+static void streamStep(void);
+
+/** @} */ // end of HAL_PRIVATE_FUNCTIONS
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Informa un acceso a la HAL a la función de registro.
+ *
+ * @param kind Tipo de acceso.
+ * @param port Puerto accedido.
+ * @param mask Pines involucrados.
+ * @param value Valor escrito o leído.
+ */
+static void record(hal_sim_access_t kind, uint8_t port, uint32_t mask, uint32_t value) {
+    accesses++;
+    if (trace) {
+        hal_sim_event_t event = {
+            .time = now, .kind = kind, .port = port, .mask = mask, .value = value};
+        trace(&event);
+    }
+}
+
+/**
+ * @brief Recalcula el nivel de los pines de un puerto y genera las interrupciones de flanco.
+ *
+ * @param port Puerto cuyos registros cambiaron.
+ */
+static void updatePort(uint8_t port) {
+    struct sim_port_s * regs = &ports[port];
+    uint32_t level = (regs->output & regs->direction) | (regs->input & ~regs->direction);
+    uint32_t changed = level ^ regs->level;
+
+    regs->level = level;
+    regs->pending |= (changed & level & regs->rising) | (changed & ~level & regs->falling);
+
+    /* Las interrupciones que se producen mientras se atiende otra quedan pendientes y se atienden
+     * al terminar, como en el hardware */
+    if (regs->pending && irq_handler && !irq_active) {
+        irq_active = true;
+        for (uint8_t index = 0; index < HAL_GPIO_PORTS; index++) {
+            while (ports[index].pending) {
+                uint32_t pending = ports[index].pending;
+                ports[index].pending = 0;
+                irq_handler(index, pending, ports[index].level);
+            }
+        }
+        irq_active = false;
+    }
+}
+
+/**
+ * @brief Calcula el instante del próximo evento de una fuente periódica.
+ *
+ * @param clock Fuente consultada.
+ * @return uint64_t Instante del próximo evento, en nanosegundos.
+ */
+static uint64_t clockNext(const struct sim_clock_s * clock) {
+    return clock->start + (clock->ticks / clock->frequency) * NANOSECONDS +
+           (clock->ticks % clock->frequency) * NANOSECONDS / clock->frequency;
+}
+
+/**
+ * @brief Transfiere la próxima palabra de la transferencia DMA simulada.
+ */
+static void streamStep(void) {
+    uint32_t word = stream.words[stream.index++];
+
+    ports[stream.port].output = (ports[stream.port].output & ~stream.mask) | (word & stream.mask);
+    record(HAL_SIM_ACCESS_STREAM, stream.port, stream.mask, word);
+    updatePort(stream.port);
+
+    if (stream.circular && stream.index == stream.count / 2) {
+        if (stream.handler) {
+            stream.handler(0, stream.context);
+        }
+    } else if (stream.index == stream.count) {
+        stream.index = 0;
+        stream.clock.running = stream.circular;
+        if (stream.handler) {
+            stream.handler(stream.circular ? 1 : 0, stream.context);
+        }
+    }
+    stream.clock.ticks++;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Configura la dirección de un pin del puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @param bit Número de pin dentro del puerto.
+ * @param output true para configurar el pin como salida, false para configurarlo como entrada.
+ */
+void hal_gpio_set_direction(uint8_t port, uint8_t bit, bool output) {
+    hal_gpio_set_port_direction(port, (uint32_t)1 << bit, output ? UINT32_MAX : 0);
+}
+
+/**
+ * @brief Configura la dirección de varios pines del puerto simulado en un único acceso.
+ *
+ * El acceso se informa a la función de seguimiento y el nivel de los pines se recalcula, lo que
+ * puede generar flancos sobre los pines que pasan a ser entradas.
+ *
+ * @param port Número de puerto.
+ * @param mask Máscara de los pines que se desean configurar.
+ * @param outputs Máscara con un bit en uno por cada pin que debe ser salida.
+ */
+void hal_gpio_set_port_direction(uint8_t port, uint32_t mask, uint32_t outputs) {
+    ports[port].direction = (ports[port].direction & ~mask) | (outputs & mask);
+    record(HAL_SIM_ACCESS_DIRECTION, port, mask, ports[port].direction);
+    updatePort(port);
+}
+
+/**
+ * @brief Establece el estado de la salida de un pin del puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @param bit Número de pin dentro del puerto.
+ * @param active true para un nivel alto, false para un nivel bajo.
+ */
+void hal_gpio_set_output(uint8_t port, uint8_t bit, bool active) {
+    if (active) {
+        hal_gpio_set_port_mask(port, (uint32_t)1 << bit, 0);
+    } else {
+        hal_gpio_set_port_mask(port, 0, (uint32_t)1 << bit);
+    }
+}
+
+/**
+ * @brief Lee el nivel de un pin del puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @param bit Número de pin dentro del puerto.
+ * @return bool true si el pin está en nivel alto, false si está en nivel bajo.
+ */
+bool hal_gpio_get_input(uint8_t port, uint8_t bit) {
+    record(HAL_SIM_ACCESS_READ, port, (uint32_t)1 << bit, ports[port].level);
+    return (ports[port].level >> bit) & 1;
+}
+
+/**
+ * @brief Lee el nivel de todos los pines del puerto simulado en un único acceso.
+ *
+ * @param port Número de puerto.
+ * @return uint32_t Nivel de los pines, un bit por pin.
+ */
+uint32_t hal_gpio_get_port(uint8_t port) {
+    record(HAL_SIM_ACCESS_READ, port, UINT32_MAX, ports[port].level);
+    return ports[port].level;
+}
+
+/**
+ * @brief Configura los flancos que generan una interrupción en un pin del puerto simulado.
+ *
+ * Las interrupciones pendientes de los pines que dejan de observarse se descartan.
+ *
+ * @param port Número de puerto.
+ * @param bit Número de pin dentro del puerto.
+ * @param edge Flancos que deben generar la interrupción.
+ * @return bool Siempre true, la simulación puede observar todos los pines.
+ */
+bool hal_gpio_set_edge(uint8_t port, uint8_t bit, hal_gpio_edge_t edge) {
+    uint32_t mask = (uint32_t)1 << bit;
+
+    ports[port].rising = (edge & HAL_GPIO_EDGE_RISING) ? (ports[port].rising | mask)
+                                                       : (ports[port].rising & ~mask);
+    ports[port].falling = (edge & HAL_GPIO_EDGE_FALLING) ? (ports[port].falling | mask)
+                                                         : (ports[port].falling & ~mask);
+    ports[port].pending &= ports[port].rising | ports[port].falling;
+    return true;
+}
+
+/**
+ * @brief Registra la función que atiende las interrupciones de flanco simuladas.
+ *
+ * @param handler Función invocada con el puerto, los pines pendientes y el nivel del puerto.
+ */
+void hal_gpio_set_irq_handler(hal_gpio_irq_handler_t handler) {
+    irq_handler = handler;
+}
+
+/**
+ * @brief Activa y desactiva varias salidas del puerto simulado en un único acceso.
+ *
+ * @param port Número de puerto.
+ * @param set Máscara de los pines que pasan a nivel alto.
+ * @param clear Máscara de los pines que pasan a nivel bajo.
+ */
+void hal_gpio_set_port_mask(uint8_t port, uint32_t set, uint32_t clear) {
+    ports[port].output = (ports[port].output & ~clear) | set;
+    record(HAL_SIM_ACCESS_WRITE, port, set | clear, ports[port].output);
+    updatePort(port);
+}
+
+/**
+ * @brief Invierte el estado de varias salidas del puerto simulado en un único acceso.
+ *
+ * @param port Número de puerto.
+ * @param mask Máscara de los pines que se desean invertir.
+ */
+void hal_gpio_toggle_port_mask(uint8_t port, uint32_t mask) {
+    ports[port].output ^= mask;
+    record(HAL_SIM_ACCESS_WRITE, port, mask, ports[port].output);
+    updatePort(port);
+}
+
+/**
+ * @brief Inicia la escritura periódica de una secuencia de palabras en un puerto simulado.
+ *
+ * La primera palabra se escribe un período después de la llamada, al avanzar el tiempo virtual con
+ * hal_sim_advance(). Solo se admite una secuencia activa a la vez.
+ *
+ * @param port Número de puerto.
+ * @param mask Máscara de los pines que modifica la secuencia.
+ * @param words Arreglo con las palabras de la secuencia.
+ * @param count Cantidad de palabras de la secuencia.
+ * @param rate Cantidad de palabras escritas por segundo.
+ * @param circular true para repetir la secuencia hasta detenerla.
+ * @param handler Función invocada en la mitad y al final de la secuencia, puede ser NULL.
+ * @param context Puntero que se pasa a la función en cada invocación.
+ * @return bool true si la secuencia se inició, false si ya hay otra activa o los datos no son
+ * válidos.
+ */
+bool hal_gpio_stream_start(uint8_t port, uint32_t mask, const uint32_t * words, size_t count,
+                           uint32_t rate, bool circular, hal_gpio_stream_handler_t handler,
+                           void * context) {
+    if (stream.clock.running || count == 0 || rate == 0) {
+        return false;
+    }
+
+    stream.port = port;
+    stream.mask = mask;
+    stream.words = words;
+    stream.count = count;
+    stream.index = 0;
+    stream.circular = circular;
+    stream.handler = handler;
+    stream.context = context;
+    stream.clock = (struct sim_clock_s){
+        .running = true, .frequency = rate, .start = now, .ticks = 1};
+    return true;
+}
+
+/**
+ * @brief Detiene la secuencia de escritura activa.
+ */
+void hal_gpio_stream_stop(void) {
+    stream.clock.running = false;
+}
+
+/**
+ * @brief Inicia un temporizador del tiempo virtual.
+ *
+ * @param timer Número de temporizador.
+ * @param frequency Frecuencia de cuenta del temporizador en Hz.
+ * @param ticks Cuentas hasta la primera invocación de la función.
+ * @param handler Función invocada al vencer el temporizador, que retorna las cuentas hasta la
+ * siguiente invocación o cero para detenerlo.
+ * @param context Puntero que se pasa a la función en cada invocación.
+ */
+void hal_timer_start(uint8_t timer, uint32_t frequency, uint32_t ticks, hal_timer_handler_t handler,
+                     void * context) {
+    if (timer < HAL_TIMER_COUNT && frequency > 0 && ticks > 0) {
+        timers[timer].handler = handler;
+        timers[timer].context = context;
+        timers[timer].clock = (struct sim_clock_s){
+            .running = true, .frequency = frequency, .start = now, .ticks = ticks};
+    }
+}
+
+/**
+ * @brief Detiene un temporizador del tiempo virtual.
+ *
+ * @param timer Número de temporizador.
+ */
+void hal_timer_stop(uint8_t timer) {
+    if (timer < HAL_TIMER_COUNT) {
+        timers[timer].clock.running = false;
+    }
+}
+
+/**
+ * @brief Lee el contador de tiempo virtual.
+ *
+ * @return uint32_t Nanosegundos de tiempo virtual transcurridos, truncados a 32 bits.
+ */
+uint32_t hal_timestamp(void) {
+    return (uint32_t)now;
+}
+
+/**
+ * @brief Obtiene la frecuencia del contador de tiempo virtual.
+ *
+ * @return uint32_t Cuentas por segundo de hal_timestamp(), una por nanosegundo.
+ */
+uint32_t hal_timestamp_frequency(void) {
+    return (uint32_t)NANOSECONDS;
+}
+
+/**
+ * @brief Detiene el procesador hasta la próxima interrupción, sin efecto en la simulación.
+ */
+void hal_cpu_sleep(void) {
+    /* El tiempo virtual solo avanza con hal_sim_advance(), no hay nada que esperar */
+}
+
+/**
+ * @brief Obtiene el número del núcleo simulado que ejecuta el código.
+ *
+ * @return uint8_t Número de núcleo configurado con hal_sim_set_cpu().
+ */
+uint8_t hal_cpu_id(void) {
+    return cpu;
+}
+
+/**
+ * @brief Deshabilita las interrupciones, sin efecto en la simulación.
+ *
+ * @return uint32_t Estado de las interrupciones, siempre cero.
+ */
+uint32_t hal_irq_lock(void) {
+    /* Las interrupciones simuladas solo se ejecutan dentro de las funciones de la HAL */
+    return 0;
+}
+
+/**
+ * @brief Restaura el estado de las interrupciones, sin efecto en la simulación.
+ *
+ * @param state Estado obtenido con hal_irq_lock().
+ */
+void hal_irq_unlock(uint32_t state) {
+    (void)state;
+}
+
+/**
+ * @brief Devuelve la simulación a su estado inicial.
+ *
+ * Se borran los puertos, los temporizadores, la secuencia activa y las funciones registradas, y el
+ * tiempo virtual vuelve a cero.
+ */
+void hal_sim_reset(void) {
+    memset(ports, 0, sizeof(ports));
+    memset(timers, 0, sizeof(timers));
+    memset(&stream, 0, sizeof(stream));
+    irq_handler = NULL;
+    irq_active = false;
+    trace = NULL;
+    now = 0;
+    accesses = 0;
+    cpu = 0;
+}
+
+/**
+ * @brief Establece el nivel que el exterior aplica sobre los pines de un puerto simulado.
+ *
+ * Si el nivel de alguna entrada observada cambia se invoca la función de interrupción registrada.
+ *
+ * @param port Número de puerto.
+ * @param mask Máscara de los pines que se desean modificar.
+ * @param value Nivel aplicado a los pines de la máscara.
+ */
+void hal_sim_set_input(uint8_t port, uint32_t mask, uint32_t value) {
+    ports[port].input = (ports[port].input & ~mask) | (value & mask);
+    updatePort(port);
+}
+
+/**
+ * @brief Obtiene el registro de salidas de un puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @return uint32_t Estado de las salidas, un bit por pin.
+ */
+uint32_t hal_sim_get_output(uint8_t port) {
+    return ports[port].output;
+}
+
+/**
+ * @brief Obtiene el registro de dirección de un puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @return uint32_t Máscara con un bit en uno por cada pin configurado como salida.
+ */
+uint32_t hal_sim_get_direction(uint8_t port) {
+    return ports[port].direction;
+}
+
+/**
+ * @brief Obtiene el nivel de los pines de un puerto simulado.
+ *
+ * @param port Número de puerto.
+ * @return uint32_t Nivel de cada pin, el de la salida o el aplicado desde el exterior.
+ */
+uint32_t hal_sim_get_level(uint8_t port) {
+    return ports[port].level;
+}
+
+/**
+ * @brief Avanza el tiempo virtual ejecutando los temporizadores y la secuencia que vencen.
+ *
+ * Los vencimientos se atienden en orden cronológico y el tiempo virtual toma el instante de cada
+ * uno antes de invocar su función.
+ *
+ * @param nanoseconds Duración del avance en nanosegundos.
+ */
+void hal_sim_advance(uint64_t nanoseconds) {
+    uint64_t target = now + nanoseconds;
+
+    for (;;) {
+        struct sim_clock_s * next = NULL;
+        uint64_t time = target;
+
+        for (uint8_t index = 0; index < HAL_TIMER_COUNT; index++) {
+            if (timers[index].clock.running && clockNext(&timers[index].clock) <= time) {
+                next = &timers[index].clock;
+                time = clockNext(next);
+            }
+        }
+        if (stream.clock.running && clockNext(&stream.clock) <= time) {
+            next = &stream.clock;
+            time = clockNext(next);
+        }
+        if (next == NULL) {
+            break;
+        }
+
+        now = time;
+        if (next == &stream.clock) {
+            streamStep();
+        } else {
+            struct sim_timer_s * timer = (struct sim_timer_s *)next;
+            uint32_t ticks = timer->handler ? timer->handler(timer->context) : 0;
+            /* La función puede haber detenido o reiniciado el temporizador */
+            if (timer->clock.running && clockNext(&timer->clock) == now) {
+                timer->clock.ticks += ticks;
+                timer->clock.running = ticks > 0;
+            }
+        }
+    }
+    now = target;
+}
+
+/**
+ * @brief Obtiene el tiempo virtual transcurrido.
+ *
+ * @return uint64_t Nanosegundos de tiempo virtual desde hal_sim_reset().
+ */
+uint64_t hal_sim_now(void) {
+    return now;
+}
+
+/**
+ * @brief Registra la función que recibe cada acceso a los puertos simulados.
+ *
+ * @param function Función de seguimiento, o NULL para dejar de informar los accesos.
+ */
+void hal_sim_set_trace(hal_sim_trace_t function) {
+    trace = function;
+}
+
+/**
+ * @brief Obtiene la cantidad de accesos a los puertos simulados.
+ *
+ * @return uint32_t Accesos realizados desde hal_sim_reset().
+ */
+uint32_t hal_sim_accesses(void) {
+    return accesses;
+}
+
+/**
+ * @brief Selecciona el núcleo simulado que informa hal_cpu_id().
+ *
+ * @param id Número de núcleo.
+ */
+void hal_sim_set_cpu(uint8_t id) {
+    cpu = id;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,140 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file hc595.c
+ * @brief Implementación del controlador de cadenas de registros 74HC595.
+ *
+ * Los 74HC595 solo tienen salidas, por lo que el controlador no provee operaciones de dirección ni
+ * de lectura y las lecturas de sus puertos devuelven el último estado escrito.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "hc595.h" /**< Declaraciones del controlador de registros 74HC595. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef HC595_MAX_INSTANCES
+#define HC595_MAX_INSTANCES 2 /**< Número máximo de cadenas que pueden ser creadas. */
+#endif
+
+#define HC595_CHIPS_PER_PORT 4 /**< Registros de 8 salidas que forman un puerto de 32 bits. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estructura que representa una cadena de registros 74HC595.
+ */
+struct hc595_s {
+    hc595_transfer_t transfer;     /**< Función que realiza el desplazamiento. */
+    void * context;                /**< Puntero que se entrega a la función. */
+    uint8_t chips;                 /**< Cantidad de registros de la cadena. */
+    uint8_t data[HC595_MAX_CHIPS]; /**< Bytes de la última transferencia. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Desplaza el estado de las salidas de todos los puertos de la cadena.
+ *
+ * @param context Cadena que se debe actualizar.
+ * @param outputs Estado de las salidas de cada puerto.
+ * @param count Cantidad de puertos de la cadena.
+ */
+static void chainWrite(void * context, const uint32_t * outputs, uint8_t count);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Operaciones del controlador, compartidas por todas las cadenas. */
+static const gpio_backend_t hc595_backend = {
+    .write = chainWrite,
+    .direction = NULL,
+    .read = NULL,
+};
+
+/** Arreglo estático que almacena las cadenas. */
+static struct hc595_s instances[HC595_MAX_INSTANCES] = {0};
+
+/** Cantidad de cadenas ya asignadas. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Desplaza el estado de las salidas de todos los puertos de la cadena.
+ *
+ * El primer byte que se desplaza llega al registro más lejano, por lo que los bytes se ordenan
+ * desde el último registro hacia el primero.
+ *
+ * @param context Cadena que se debe actualizar.
+ * @param outputs Estado de las salidas de cada puerto.
+ * @param count Cantidad de puertos de la cadena.
+ */
+static void chainWrite(void * context, const uint32_t * outputs, uint8_t count) {
+    hc595_t self = context;
+
+    (void)count;
+    for (uint8_t chip = 0; chip < self->chips; chip++) {
+        uint32_t word = outputs[chip / HC595_CHIPS_PER_PORT];
+
+        self->data[self->chips - 1 - chip] = (uint8_t)(word >> (8 * (chip % HC595_CHIPS_PER_PORT)));
+    }
+    self->transfer(self->context, self->data, self->chips);
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea una cadena de registros 74HC595 y la asocia a puertos virtuales.
+ *
+ * @param port Primer puerto virtual.
+ * @param chips Cantidad de registros de la cadena.
+ * @param transfer Función que realiza el desplazamiento y la carga.
+ * @param context Puntero que se entrega a la función de transferencia.
+ * @return hc595_t Cadena creada o NULL si no hay recursos o los puertos no están disponibles.
+ */
+hc595_t hc595Create(gpio_port_t port, uint8_t chips, hc595_transfer_t transfer, void * context) {
+    if (chips == 0 || chips > HC595_MAX_CHIPS || transfer == NULL ||
+        instances_used >= HC595_MAX_INSTANCES) {
+        return NULL;
+    }
+
+    hc595_t self = &instances[instances_used];
+    uint8_t ports = (chips + HC595_CHIPS_PER_PORT - 1) / HC595_CHIPS_PER_PORT;
+
+    self->transfer = transfer;
+    self->context = context;
+    self->chips = chips;
+    if (!gpioBackendAttach(port, ports, &hc595_backend, self)) {
+        return NULL;
+    }
+    instances_used++;
+    return self;
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,309 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file keypad.c
+ * @brief Implementación del teclado matricial.
+ *
+ * Las filas y las columnas se manejan como grupos de pines, por lo que cada paso del barrido es una
+ * escritura por cada puerto de las filas y una lectura por cada puerto de las columnas. Las
+ * muestras de todas las teclas se filtran en paralelo con uno o dos filtros antirrebote de 32
+ * teclas cada uno.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "keypad.h" /**< Declaraciones del teclado matricial. */
+#include <stddef.h> /**< Biblioteca estándar que define los macros para NULL y tamaños. */
+#include "debounce.h" /**< Filtro antirrebote de las teclas. */
+#include "gpio_group.h" /**< Grupos de pines de las filas y las columnas. */
+#include "gpio_backend.h" /**< Cantidad total de puertos, incluidos los virtuales. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware para el bajo consumo. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef KEYPAD_MAX_INSTANCES
+#define KEYPAD_MAX_INSTANCES 2 /**< Número máximo de teclados que pueden ser creados. */
+#endif
+
+#define KEYPAD_FILTERS 2 /**< Filtros antirrebote necesarios para el máximo de teclas. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estructura que representa un teclado matricial.
+ */
+struct keypad_s {
+    gpio_group_t rows;                      /**< Grupo de las filas. */
+    gpio_group_t columns;                   /**< Grupo de las columnas. */
+    gpio_t column_pins[KEYPAD_MAX_COLUMNS]; /**< Columnas, para habilitar sus interrupciones. */
+    uint8_t rows_count;                     /**< Cantidad de filas. */
+    uint8_t columns_count;                  /**< Cantidad de columnas. */
+    debounce_t filters[KEYPAD_FILTERS];     /**< Filtros de las teclas 0 a 31 y 32 a 63. */
+    uint8_t row;                            /**< Fila seleccionada, `rows_count` si ninguna. */
+    uint64_t sample;                        /**< Teclas leídas en las filas ya barridas. */
+    uint64_t keys;                          /**< Teclas presionadas según el filtro. */
+    volatile bool idle;                     /**< Indica si el teclado espera una tecla. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Deja el teclado en reposo esperando el flanco descendente de alguna columna.
+ *
+ * @param self Teclado que se deja en reposo.
+ */
+static void keypadPark(keypad_t self);
+
+/**
+ * @brief Sale del reposo ante el flanco de una columna.
+ *
+ * @param gpio Columna que generó el flanco.
+ * @param level Nivel de la columna.
+ * @param context Teclado al que pertenece la columna.
+ */
+static void keypadWake(gpio_t gpio, bool level, void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Arreglo estático que almacena los teclados. */
+static struct keypad_s instances[KEYPAD_MAX_INSTANCES] = {0};
+
+/** Cantidad de teclados ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Deja el teclado en reposo esperando el flanco descendente de alguna columna.
+ *
+ * Con todas las filas en bajo cualquier tecla presionada pone su columna en bajo. Después de
+ * habilitar las interrupciones se leen las columnas, para no perder una tecla presionada entre el
+ * último barrido y la habilitación. Si alguna columna no puede generar la interrupción el teclado
+ * sale del reposo y se sigue barriendo.
+ *
+ * @param self Teclado que se deja en reposo.
+ */
+static void keypadPark(keypad_t self) {
+    uint32_t released = ((uint32_t)1 << self->columns_count) - 1;
+    bool armed = true;
+
+    gpioGroupWrite(self->rows, 0);
+    self->idle = true;
+    for (uint8_t column = 0; column < self->columns_count; column++) {
+        if (!gpioOnEdge(self->column_pins[column], GPIO_EDGE_FALLING, keypadWake, self)) {
+            armed = false; /**< Sin la interrupción de la columna el teclado no puede dormir. */
+        }
+    }
+    if (!armed || gpioGroupRead(self->columns) != released) {
+        keypadWake(NULL, false, self);
+    }
+}
+
+/**
+ * @brief Sale del reposo ante el flanco de una columna.
+ *
+ * Se deshabilitan las interrupciones de todas las columnas, ya que durante el barrido las filas
+ * cambian y generarían flancos en cada paso. Las filas quedan en bajo, por lo que el barrido
+ * siguiente comienza sin ninguna fila seleccionada.
+ *
+ * @param gpio Columna que generó el flanco.
+ * @param level Nivel de la columna.
+ * @param context Teclado al que pertenece la columna.
+ */
+static void keypadWake(gpio_t gpio, bool level, void * context) {
+    keypad_t self = context;
+
+    (void)gpio;
+    (void)level;
+    for (uint8_t column = 0; column < self->columns_count; column++) {
+        gpioOnEdge(self->column_pins[column], GPIO_EDGE_NONE, NULL, NULL);
+    }
+    self->row = self->rows_count;
+    self->idle = false;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un teclado matricial.
+ *
+ * Los parámetros y la cantidad de grupos y filtros disponibles se verifican antes de reservar
+ * ninguno, ya que no pueden liberarse si la creación falla a mitad de camino.
+ *
+ * @param rows Objetos GPIO de las filas.
+ * @param rows_count Cantidad de filas.
+ * @param columns Objetos GPIO de las columnas.
+ * @param columns_count Cantidad de columnas.
+ * @param count Cantidad de barridos consecutivos necesarios para aceptar un cambio.
+ * @return keypad_t Teclado creado o NULL si los parámetros no son válidos o no hay recursos.
+ */
+keypad_t keypadCreate(const gpio_t * rows, uint8_t rows_count, const gpio_t * columns,
+                      uint8_t columns_count, uint8_t count) {
+    uint8_t keys = (uint8_t)(rows_count * columns_count);
+    uint8_t filters = (uint8_t)((keys + 31) / 32);
+
+    if (rows == NULL || rows_count == 0 || rows_count > KEYPAD_MAX_ROWS || columns == NULL ||
+        columns_count == 0 || columns_count > KEYPAD_MAX_COLUMNS ||
+        instances_used >= KEYPAD_MAX_INSTANCES) {
+        return NULL;
+    }
+    uint32_t used[GPIO_PORTS] = {0};
+    for (uint8_t index = 0; index < rows_count + columns_count; index++) {
+        gpio_t pin = index < rows_count ? rows[index] : columns[index - rows_count];
+
+        if (pin == NULL || (used[gpioGetPort(pin)] & gpioGetMask(pin))) {
+            return NULL; /**< Falta un pin o se repite en las filas o las columnas. */
+        }
+        used[gpioGetPort(pin)] |= gpioGetMask(pin);
+    }
+    if (gpioGroupAvailable() < 2 || debounceAvailable() < filters) {
+        return NULL; /**< Los grupos y los filtros no se destruyen, no se reserva ninguno. */
+    }
+
+    keypad_t self = &instances[instances_used++];
+    self->rows = gpioGroupCreate(rows, rows_count);
+    self->columns = gpioGroupCreate(columns, columns_count);
+    for (uint8_t filter = 0; filter < KEYPAD_FILTERS; filter++) {
+        self->filters[filter] = NULL;
+        if (filter < filters) {
+            uint8_t width = keys - 32 * filter;
+            uint32_t mask = width >= 32 ? UINT32_MAX : ((uint32_t)1 << width) - 1;
+
+            /* Ninguna tecla presionada, los filtros se alimentan con las muestras del barrido */
+            self->filters[filter] = debounceCreate(DEBOUNCE_NO_PORT, mask, count);
+        }
+    }
+
+    self->rows_count = rows_count;
+    self->columns_count = columns_count;
+    self->row = rows_count;
+    self->sample = 0;
+    self->keys = 0;
+    self->idle = false;
+    for (uint8_t column = 0; column < columns_count; column++) {
+        self->column_pins[column] = columns[column];
+        gpioSetOutput(columns[column], false);
+    }
+    gpioGroupWrite(self->rows, UINT32_MAX); /**< Las filas arrancan en alto, sin seleccionar. */
+    for (uint8_t row = 0; row < rows_count; row++) {
+        gpioSetOutput(rows[row], true);
+    }
+    return self;
+}
+
+/**
+ * @brief Barre el teclado y actualiza el estado filtrado de las teclas.
+ *
+ * Cada fila se selecciona poniéndola en bajo mientras las demás quedan en alto, y las columnas
+ * leídas en bajo corresponden a teclas presionadas de esa fila. Para que las columnas se
+ * estabilicen después de cambiar la fila, cada llamada lee las columnas de la fila seleccionada
+ * en la llamada anterior y luego selecciona la siguiente, de modo que entre la selección y la
+ * lectura transcurre un período completo. Al leer la última fila se filtra el barrido y, si no
+ * queda ninguna tecla presionada ni en proceso de cambio, el teclado pasa al reposo.
+ *
+ * @param self Teclado que se desea barrer.
+ * @return uint64_t Máscara con las teclas cuyo estado filtrado cambió, siempre cero hasta
+ * completar el barrido.
+ */
+uint64_t keypadScan(keypad_t self) {
+    uint32_t all_rows = ((uint32_t)1 << self->rows_count) - 1;
+    uint32_t all_columns = ((uint32_t)1 << self->columns_count) - 1;
+    uint64_t changed = 0;
+
+    if (self->idle) {
+        return 0;
+    }
+
+    if (self->row < self->rows_count) {
+        uint64_t pressed = ~gpioGroupRead(self->columns) & all_columns;
+
+        self->sample |= pressed << (self->row * self->columns_count);
+        self->row++;
+    } else {
+        self->row = 0; /**< Ninguna fila seleccionada, comienza un barrido. */
+        self->sample = 0;
+    }
+    if (self->row < self->rows_count) {
+        gpioGroupWrite(self->rows, all_rows & ~((uint32_t)1 << self->row));
+        return 0; /**< Las columnas se leen en la próxima llamada. */
+    }
+
+    uint64_t sample = self->sample;
+
+    self->row = 0; /**< La primera fila del barrido siguiente se estabiliza hasta la próxima. */
+    self->sample = 0;
+    gpioGroupWrite(self->rows, all_rows & ~(uint32_t)1);
+
+    for (uint8_t filter = 0; filter < KEYPAD_FILTERS && self->filters[filter]; filter++) {
+        uint32_t half = (uint32_t)(sample >> 32 * filter);
+
+        changed |= (uint64_t)debounceFilter(self->filters[filter], half) << 32 * filter;
+    }
+    self->keys ^= changed;
+
+    if (self->keys == 0 && sample == 0) {
+        keypadPark(self);
+    }
+    return changed;
+}
+
+/**
+ * @brief Obtiene las teclas presionadas.
+ *
+ * @param self Teclado consultado.
+ * @return uint64_t Máscara con las teclas presionadas.
+ */
+uint64_t keypadGetKeys(keypad_t self) {
+    return self->keys;
+}
+
+/**
+ * @brief Indica si el teclado está en reposo esperando una tecla.
+ *
+ * @param self Teclado consultado.
+ * @return bool true si el teclado está en reposo.
+ */
+bool keypadIdle(keypad_t self) {
+    return self->idle;
+}
+
+/**
+ * @brief Detiene el procesador mientras el teclado está en reposo.
+ *
+ * Si la interrupción de la columna se produce entre la consulta y la detención, el procesador
+ * despierta con la siguiente interrupción, por ejemplo la del temporizador del barrido.
+ *
+ * @param self Teclado que se espera.
+ */
+void keypadSleep(keypad_t self) {
+    if (self->idle) {
+        hal_cpu_sleep();
+    }
+}
+
+/* === End of documentation ==================================================================== */
@@ -32,7 +32,7 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 #include "main.h" /**< Archivo de cabecera para la definición de funciones principales. */
-#include "gpio.h" /**< Archivo de cabecera para la configuración y manejo de pines GPIO. */
+#include "gpio_pin.h" /**< Archivo de cabecera para el manejo de pines GPIO constantes. */
 
 /* === Macros definitions ====================================================================== */
 #define LED_RED_BIT  7 /**< Número de bit del LED rojo en el puerto GPIO. */
@@ -48,6 +48,9 @@ SPDX-License-Identifier: MIT
 
 /* === Private variable definitions ============================================================ */
 
+/** Descriptor del pin del LED rojo, resuelto completamente en tiempo de compilación. */
+static const gpio_pin_t LED_RED = GPIO_PIN(LED_RED_PORT, LED_RED_BIT);
+
 /* === Private function implementation ========================================================= */
 
 /* === Public function implementation ========================================================== */
@@ -61,9 +64,8 @@ SPDX-License-Identifier: MIT
  * @return int Retorna 0 para indicar que el programa finalizó correctamente.
  */
 int main(void) {
-    gpio_t red_led = gpioCreate(LED_RED_PORT, LED_RED_BIT); /**< Crea el objeto para el LED rojo. */
-    gpioSetOutput(red_led, true);                           /**< Configura el pin como salida. */
-    gpioSetState(red_led, false); /**< Establece el estado del LED rojo en apagado. */
+    gpioPinSetOutput(LED_RED, true);  /**< Configura el pin como salida. */
+    gpioPinSetState(LED_RED, false); /**< Establece el estado del LED rojo en apagado. */
 
     return 0; /**< Finaliza la ejecución del programa. */
 }
@@ -0,0 +1,207 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file mcp23017.c
+ * @brief Implementación del controlador de expansores MCP23017.
+ *
+ * Las salidas se escriben en los registros OLAT y la dirección en los registros IODIR, que usan un
+ * bit en uno para las entradas. Las lecturas toman el nivel de los pines de los registros GPIO.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "mcp23017.h" /**< Declaraciones del controlador de expansores MCP23017. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef MCP23017_MAX_INSTANCES
+#define MCP23017_MAX_INSTANCES 4 /**< Número máximo de expansores que pueden ser creados. */
+#endif
+
+#define MCP23017_IODIRA 0x00 /**< Registro de dirección del puerto A, seguido por el del B. */
+#define MCP23017_GPIOA  0x12 /**< Registro de nivel del puerto A, seguido por el del B. */
+#define MCP23017_OLATA  0x14 /**< Registro de salida del puerto A, seguido por el del B. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estructura que representa un expansor MCP23017.
+ */
+struct mcp23017_s {
+    mcp23017_write_t write; /**< Función que escribe en el bus. */
+    mcp23017_read_t read;   /**< Función que lee del bus o NULL. */
+    void * context;         /**< Puntero que se entrega a las funciones. */
+    uint8_t address;        /**< Dirección I2C del expansor. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Escribe un par de registros de los puertos A y B en una transacción.
+ *
+ * @param self Expansor que se desea escribir.
+ * @param reg Registro del puerto A.
+ * @param value Valor de los 16 pines.
+ */
+static void registerWrite(mcp23017_t self, uint8_t reg, uint32_t value);
+
+/**
+ * @brief Escribe las salidas del expansor.
+ *
+ * @param context Expansor que se debe actualizar.
+ * @param outputs Estado de las salidas.
+ * @param count Cantidad de puertos, siempre uno.
+ */
+static void expanderWrite(void * context, const uint32_t * outputs, uint8_t count);
+
+/**
+ * @brief Escribe la dirección de los pines del expansor.
+ *
+ * @param context Expansor que se debe actualizar.
+ * @param outputs Pines configurados como salida.
+ * @param count Cantidad de puertos, siempre uno.
+ */
+static void expanderDirection(void * context, const uint32_t * outputs, uint8_t count);
+
+/**
+ * @brief Lee el nivel de los pines del expansor.
+ *
+ * @param context Expansor que se desea leer.
+ * @param index Puerto dentro del controlador, siempre cero.
+ * @return uint32_t Nivel de los 16 pines.
+ */
+static uint32_t expanderRead(void * context, uint8_t index);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Operaciones del controlador para los expansores que permiten leer. */
+static const gpio_backend_t mcp23017_backend = {
+    .write = expanderWrite,
+    .direction = expanderDirection,
+    .read = expanderRead,
+};
+
+/** Operaciones del controlador para los expansores que solo se usan como salida. */
+static const gpio_backend_t mcp23017_output_backend = {
+    .write = expanderWrite,
+    .direction = expanderDirection,
+    .read = NULL,
+};
+
+/** Arreglo estático que almacena los expansores. */
+static struct mcp23017_s instances[MCP23017_MAX_INSTANCES] = {0};
+
+/** Cantidad de expansores ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Escribe un par de registros de los puertos A y B en una transacción.
+ *
+ * @param self Expansor que se desea escribir.
+ * @param reg Registro del puerto A.
+ * @param value Valor de los 16 pines.
+ */
+static void registerWrite(mcp23017_t self, uint8_t reg, uint32_t value) {
+    uint8_t data[3] = {reg, (uint8_t)value, (uint8_t)(value >> 8)};
+
+    self->write(self->context, self->address, data, sizeof(data));
+}
+
+/**
+ * @brief Escribe las salidas del expansor.
+ *
+ * @param context Expansor que se debe actualizar.
+ * @param outputs Estado de las salidas.
+ * @param count Cantidad de puertos, siempre uno.
+ */
+static void expanderWrite(void * context, const uint32_t * outputs, uint8_t count) {
+    (void)count;
+    registerWrite(context, MCP23017_OLATA, outputs[0]);
+}
+
+/**
+ * @brief Escribe la dirección de los pines del expansor.
+ *
+ * @param context Expansor que se debe actualizar.
+ * @param outputs Pines configurados como salida.
+ * @param count Cantidad de puertos, siempre uno.
+ */
+static void expanderDirection(void * context, const uint32_t * outputs, uint8_t count) {
+    (void)count;
+    registerWrite(context, MCP23017_IODIRA, ~outputs[0]); /**< Un bit en uno indica entrada. */
+}
+
+/**
+ * @brief Lee el nivel de los pines del expansor.
+ *
+ * @param context Expansor que se desea leer.
+ * @param index Puerto dentro del controlador, siempre cero.
+ * @return uint32_t Nivel de los 16 pines.
+ */
+static uint32_t expanderRead(void * context, uint8_t index) {
+    mcp23017_t self = context;
+    uint8_t data[2];
+
+    (void)index;
+    self->read(self->context, self->address, MCP23017_GPIOA, data, sizeof(data));
+    return data[0] | (uint32_t)data[1] << 8;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un expansor MCP23017 y lo asocia a un puerto virtual.
+ *
+ * @param port Puerto virtual del expansor.
+ * @param address Dirección de 7 bits del expansor.
+ * @param write Función que escribe en el bus I2C.
+ * @param read Función que lee del bus I2C o NULL.
+ * @param context Puntero que se entrega a las funciones del bus.
+ * @return mcp23017_t Expansor creado o NULL si no hay recursos o el puerto no está disponible.
+ */
+mcp23017_t mcp23017Create(gpio_port_t port, uint8_t address, mcp23017_write_t write,
+                          mcp23017_read_t read, void * context) {
+    if (write == NULL || instances_used >= MCP23017_MAX_INSTANCES) {
+        return NULL;
+    }
+
+    mcp23017_t self = &instances[instances_used];
+    self->write = write;
+    self->read = read;
+    self->context = context;
+    self->address = address;
+    if (!gpioBackendAttach(port, 1, read ? &mcp23017_backend : &mcp23017_output_backend, self)) {
+        return NULL;
+    }
+    instances_used++;
+    return self;
+}
+
+/* === End of documentation ==================================================================== */
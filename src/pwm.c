@@ -0,0 +1,301 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file pwm.c
+ * @brief Implementación del generador de señales PWM por software.
+ *
+ * Cada generador mantiene dos agendas de conmutación. La rutina de interrupción recorre la agenda
+ * activa y la aplicación construye la otra cuando cambia un ciclo de trabajo; el intercambio se
+ * produce al comienzo de un período, con una variable atómica que evita bloquear interrupciones.
+ *
+ * @author Luis Francisco Herrera Garay
+ * @date 2024
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "pwm.h" /**< Declaraciones del generador PWM. */
+#include <stddef.h> /**< Biblioteca estándar que define los macros para NULL y tamaños. */
+#include <stdatomic.h> /**< Biblioteca estándar para accesos atómicos. */
+#include "hal.h" /**< Archivo que abstrae las funciones de hardware y los temporizadores. */
+
+/* === Macros definitions ====================================================================== */
+
+#ifndef PWM_MAX_INSTANCES
+#define PWM_MAX_INSTANCES 1 /**< Número máximo de generadores que pueden ser creados. */
+#endif
+
+/** Cantidad máxima de conmutaciones por período: un encendido y un apagado por cada canal. */
+#define PWM_MAX_EDGES (2 * PWM_MAX_CHANNELS)
+
+#define PWM_ACTIVE_MASK 0x1 /**< Bit de `pwm_s::agenda` que indica la agenda activa. */
+#define PWM_PENDING     0x2 /**< Bit de `pwm_s::agenda` que indica una agenda nueva pendiente. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Conmutación de un conjunto de canales de un mismo puerto.
+ */
+struct pwm_edge_s {
+    uint32_t time;  /**< Instante de la conmutación, en cuentas desde el comienzo del período. */
+    uint32_t mask;  /**< Pines del puerto que se escriben. */
+    uint32_t value; /**< Valor que se escribe en los pines. */
+    uint8_t port;   /**< Puerto de los pines. */
+};
+
+/**
+ * @brief Agenda de conmutaciones de un período, ordenada por instante.
+ */
+struct pwm_schedule_s {
+    struct pwm_edge_s edges[PWM_MAX_EDGES]; /**< Conmutaciones del período. */
+    uint8_t count;                          /**< Cantidad de conmutaciones de la agenda. */
+};
+
+/**
+ * @brief Estructura que representa un generador PWM.
+ */
+struct pwm_s {
+    uint8_t timer;                      /**< Temporizador de hardware utilizado. */
+    uint8_t count;                      /**< Cantidad de canales. */
+    uint8_t next;                       /**< Próxima conmutación de la agenda activa. */
+    uint32_t frequency;                 /**< Frecuencia de cuenta del temporizador. */
+    uint32_t period;                    /**< Duración del período en cuentas. */
+    gpio_t outputs[PWM_MAX_CHANNELS];   /**< Pines de cada canal. */
+    uint32_t duty[PWM_MAX_CHANNELS];    /**< Ciclo de trabajo de cada canal. */
+    struct pwm_schedule_s schedules[2]; /**< Agendas activa y en preparación. */
+    atomic_uint agenda;                 /**< Agenda activa y bandera de agenda pendiente. */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Construye la agenda de conmutaciones a partir de los ciclos de trabajo.
+ *
+ * @param self Generador del que se toman los canales.
+ * @param schedule Agenda que se debe completar.
+ */
+static void buildSchedule(pwm_t self, struct pwm_schedule_s * schedule);
+
+/**
+ * @brief Agrega una conmutación a la agenda, combinándola con una existente si coincide.
+ *
+ * @param schedule Agenda que se está construyendo.
+ * @param time Instante de la conmutación.
+ * @param gpio Pin que conmuta.
+ * @param value Estado que toma el pin.
+ */
+static void addEdge(struct pwm_schedule_s * schedule, uint32_t time, gpio_t gpio, bool value);
+
+/**
+ * @brief Atiende la interrupción del temporizador del generador.
+ *
+ * @param context Generador que se debe atender.
+ * @return uint32_t Cantidad de cuentas hasta la próxima conmutación.
+ */
+static uint32_t timerHandler(void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Arreglo estático que almacena los generadores. */
+static struct pwm_s instances[PWM_MAX_INSTANCES] = {0};
+
+/** Cantidad de generadores ya asignados. */
+static uint8_t instances_used = 0;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Agrega una conmutación a la agenda, combinándola con una existente si coincide.
+ *
+ * Las conmutaciones se mantienen ordenadas por instante con una inserción directa. Si ya existe
+ * una conmutación del mismo puerto en el mismo instante, el pin se agrega a su máscara.
+ *
+ * @param schedule Agenda que se está construyendo.
+ * @param time Instante de la conmutación.
+ * @param gpio Pin que conmuta.
+ * @param value Estado que toma el pin.
+ */
+static void addEdge(struct pwm_schedule_s * schedule, uint32_t time, gpio_t gpio, bool value) {
+    uint8_t port = gpioGetPort(gpio);
+    uint32_t mask = gpioGetMask(gpio);
+    uint8_t index = schedule->count;
+
+    for (uint8_t edge = 0; edge < schedule->count; edge++) {
+        if (schedule->edges[edge].time == time && schedule->edges[edge].port == port) {
+            schedule->edges[edge].mask |= mask;
+            schedule->edges[edge].value |= value ? mask : 0;
+            return;
+        }
+    }
+
+    while (index > 0 && schedule->edges[index - 1].time > time) {
+        schedule->edges[index] = schedule->edges[index - 1]; /**< Desplaza las posteriores. */
+        index--;
+    }
+    schedule->edges[index].time = time;
+    schedule->edges[index].port = port;
+    schedule->edges[index].mask = mask;
+    schedule->edges[index].value = value ? mask : 0;
+    schedule->count++;
+}
+
+/**
+ * @brief Construye la agenda de conmutaciones a partir de los ciclos de trabajo.
+ *
+ * Al comienzo del período se encienden los canales con ciclo de trabajo no nulo y se apagan los
+ * que tienen ciclo nulo. Cada canal que no permanece encendido todo el período agrega además un
+ * apagado en el instante indicado por su ciclo de trabajo.
+ *
+ * @param self Generador del que se toman los canales.
+ * @param schedule Agenda que se debe completar.
+ */
+static void buildSchedule(pwm_t self, struct pwm_schedule_s * schedule) {
+    schedule->count = 0;
+    for (uint8_t channel = 0; channel < self->count; channel++) {
+        addEdge(schedule, 0, self->outputs[channel], self->duty[channel] > 0);
+    }
+    for (uint8_t channel = 0; channel < self->count; channel++) {
+        if (self->duty[channel] > 0 && self->duty[channel] < self->period) {
+            addEdge(schedule, self->duty[channel], self->outputs[channel], false);
+        }
+    }
+}
+
+/**
+ * @brief Atiende la interrupción del temporizador del generador.
+ *
+ * Al comienzo de cada período se adopta la agenda pendiente, si la hay. Luego se aplican todas las
+ * conmutaciones del instante actual, una por puerto, y se devuelve la distancia a la siguiente.
+ *
+ * @param context Generador que se debe atender.
+ * @return uint32_t Cantidad de cuentas hasta la próxima conmutación.
+ */
+static uint32_t timerHandler(void * context) {
+    pwm_t self = context;
+    unsigned int agenda = atomic_load_explicit(&self->agenda, memory_order_acquire);
+
+    if (self->next == 0 && (agenda & PWM_PENDING)) {
+        agenda = (agenda ^ PWM_ACTIVE_MASK) & ~PWM_PENDING;
+        atomic_store_explicit(&self->agenda, agenda, memory_order_release);
+    }
+
+    const struct pwm_schedule_s * schedule = &self->schedules[agenda & PWM_ACTIVE_MASK];
+    uint32_t now = schedule->edges[self->next].time;
+    do {
+        const struct pwm_edge_s * edge = &schedule->edges[self->next++];
+        gpioPortWrite(edge->port, edge->mask, edge->value);
+    } while (self->next < schedule->count && schedule->edges[self->next].time == now);
+
+    if (self->next >= schedule->count) {
+        self->next = 0;
+        return self->period - now; /**< Espera el comienzo del próximo período. */
+    }
+    return schedule->edges[self->next].time - now;
+}
+
+/* === Public function implementation ========================================================== */
+
+/**
+ * @brief Crea un generador PWM sobre un conjunto de pines.
+ *
+ * El latch de salida de cada pin se borra a nivel de puerto antes de configurarlo como salida, ya
+ * que gpioSetState() descarta las escrituras sobre entradas, de forma que el canal arranca en bajo
+ * sin pulsos espurios.
+ *
+ * @param timer Temporizador de hardware que utiliza el generador.
+ * @param frequency Frecuencia de cuenta del temporizador en Hz.
+ * @param period Duración del período PWM en cuentas del temporizador.
+ * @param outputs Arreglo con los pines de cada canal.
+ * @param count Cantidad de canales.
+ * @return pwm_t Generador creado o NULL si no se pudo crear.
+ */
+pwm_t pwmCreate(uint8_t timer, uint32_t frequency, uint32_t period, const gpio_t * outputs,
+                uint8_t count) {
+    pwm_t self = NULL;
+
+    if (instances_used < PWM_MAX_INSTANCES && count > 0 && count <= PWM_MAX_CHANNELS &&
+        period > 0) {
+        self = &instances[instances_used++];
+        self->timer = timer;
+        self->frequency = frequency;
+        self->period = period;
+        self->count = count;
+        self->next = 0;
+        for (uint8_t channel = 0; channel < count; channel++) {
+            self->outputs[channel] = outputs[channel];
+            self->duty[channel] = 0;
+            gpioPortClear(gpioGetPort(outputs[channel]), gpioGetMask(outputs[channel]));
+            gpioSetOutput(outputs[channel], true);
+        }
+        buildSchedule(self, &self->schedules[0]);
+        atomic_init(&self->agenda, 0);
+    }
+    return self;
+}
+
+/**
+ * @brief Cambia el ciclo de trabajo de un canal.
+ *
+ * Primero se retira la bandera de agenda pendiente, con lo que la interrupción deja de poder
+ * adoptar la agenda en preparación; luego se la reconstruye y se vuelve a marcar como pendiente.
+ *
+ * @param self Generador que se desea modificar.
+ * @param channel Número de canal.
+ * @param duty Duración del estado alto en cuentas del temporizador.
+ */
+void pwmSetDuty(pwm_t self, uint8_t channel, uint32_t duty) {
+    if (channel < self->count) {
+        unsigned int agenda =
+            atomic_fetch_and_explicit(&self->agenda, ~PWM_PENDING, memory_order_acq_rel);
+
+        self->duty[channel] = (duty > self->period) ? self->period : duty;
+        buildSchedule(self, &self->schedules[(agenda & PWM_ACTIVE_MASK) ^ 1]);
+        atomic_fetch_or_explicit(&self->agenda, PWM_PENDING, memory_order_release);
+    }
+}
+
+/**
+ * @brief Inicia la generación de las señales.
+ *
+ * @param self Generador que se desea iniciar.
+ */
+void pwmStart(pwm_t self) {
+    self->next = 0;
+    hal_timer_start(self->timer, self->frequency, 1, timerHandler, self);
+}
+
+/**
+ * @brief Detiene la generación de las señales y pone en bajo todos los canales.
+ *
+ * @param self Generador que se desea detener.
+ */
+void pwmStop(pwm_t self) {
+    hal_timer_stop(self->timer);
+    for (uint8_t channel = 0; channel < self->count; channel++) {
+        gpioSetState(self->outputs[channel], false);
+    }
+}
+
+/* === End of documentation ==================================================================== */
@@ -0,0 +1,324 @@
+/************************************************************************************************
+Copyright (c) 2024, Luis Francisco Herrera Garay<lf.herreragaray@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/**
+ * @file trace2vcd.c
+ * @brief Conversión del registro de actividad de los GPIO al formato VCD.
+ *
+ * Este programa se ejecuta en la computadora y decodifica los bytes obtenidos con gpioTraceRead(),
+ * guardados en un archivo, para generar un archivo VCD que puede visualizarse con GTKWave. Cada
+ * puerto que aparece en el registro se representa con hasta tres señales de 32 bits: el estado de
+ * las salidas, la dirección de los pines y el estado de las entradas al atender un flanco. Los
+ * bytes previos al primer registro de sincronización se descartan, por lo que el archivo puede
+ * comenzar en cualquier punto del flujo.
+ *
+ * Se compila con `make trace2vcd` y se ejecuta como `trace2vcd entrada [salida]`.
+ */
+
+/* === Headers files inclusions =============================================================== */
+#include "gpio_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define TRACE_PORTS 32 /**< Cantidad de puertos que admite el formato del registro. */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Estado del decodificador del registro.
+ */
+typedef struct decoder_s {
+    const uint8_t * data;                         /**< Bytes del registro. */
+    size_t size;                                  /**< Cantidad de bytes del registro. */
+    size_t offset;                                /**< Posición del próximo byte. */
+    bool synced;                                  /**< Se encontró una sincronización. */
+    bool absolute;                                /**< El próximo tiempo es absoluto. */
+    uint32_t frequency;                           /**< Frecuencia del contador. */
+    uint32_t stamp;                               /**< Último valor del contador. */
+    uint64_t ticks;                               /**< Cuentas desde el primer registro. */
+    uint32_t last[GPIO_TRACE_KINDS][TRACE_PORTS]; /**< Referencias de la codificación. */
+    uint32_t used[GPIO_TRACE_KINDS];              /**< Puertos que aparecen en el registro. */
+} decoder_t;
+
+/**
+ * @brief Función invocada por cada registro con valor decodificado.
+ */
+typedef void (*record_cb_t)(decoder_t * decoder, uint8_t kind, uint8_t port, uint32_t value,
+                            void * context);
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Lee un entero de longitud variable del registro.
+ *
+ * @param decoder Estado del decodificador.
+ * @param value Variable donde se almacena el entero leído.
+ * @return bool true si se leyó el entero, false si el registro terminó antes.
+ */
+static bool readVarint(decoder_t * decoder, uint32_t * value);
+
+/**
+ * @brief Decodifica el registro completo.
+ *
+ * @param decoder Estado del decodificador, con los bytes del registro.
+ * @param callback Función invocada por cada registro con valor posterior a una sincronización.
+ * @param context Puntero que se pasa a la función en cada invocación.
+ * @return bool true si el registro es válido, false si contiene un tipo de registro desconocido.
+ */
+static bool decode(decoder_t * decoder, record_cb_t callback, void * context);
+
+/**
+ * @brief Marca el puerto de un registro como utilizado.
+ *
+ * @param decoder Estado del decodificador.
+ * @param kind Tipo de registro.
+ * @param port Número de puerto.
+ * @param value No se utiliza.
+ * @param context No se utiliza.
+ */
+static void collectPort(decoder_t * decoder, uint8_t kind, uint8_t port, uint32_t value,
+                        void * context);
+
+/**
+ * @brief Escribe un registro como un cambio de valor en el archivo VCD.
+ *
+ * @param decoder Estado del decodificador.
+ * @param kind Tipo de registro.
+ * @param port Número de puerto.
+ * @param value Estado de los pines del puerto.
+ * @param context Archivo de salida.
+ */
+static void writeChange(decoder_t * decoder, uint8_t kind, uint8_t port, uint32_t value,
+                        void * context);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/** Nombre de la señal de cada tipo de registro. */
+static const char * const kind_names[GPIO_TRACE_KINDS] = {"out", "dir", "in"};
+
+/** Último valor escrito de cada señal, para omitir los registros que no la modifican. */
+static uint32_t written[GPIO_TRACE_KINDS][TRACE_PORTS];
+
+/** Indica si cada señal ya tiene un valor escrito. */
+static uint32_t valid[GPIO_TRACE_KINDS];
+
+/** Último instante escrito en el archivo, en nanosegundos, o UINT64_MAX si no hay ninguno. */
+static uint64_t written_time = UINT64_MAX;
+
+/* === Private function implementation ========================================================= */
+
+/**
+ * @brief Lee un entero de longitud variable del registro.
+ *
+ * @param decoder Estado del decodificador.
+ * @param value Variable donde se almacena el entero leído.
+ * @return bool true si se leyó el entero, false si el registro terminó antes.
+ */
+static bool readVarint(decoder_t * decoder, uint32_t * value) {
+    uint32_t result = 0;
+
+    for (unsigned int shift = 0; decoder->offset < decoder->size; shift += 7) {
+        uint8_t byte = decoder->data[decoder->offset++];
+
+        if (shift < 32) {
+            result |= (uint32_t)(byte & 0x7F) << shift;
+        }
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decodifica el registro completo.
+ *
+ * Un registro incompleto al final de los datos se descarta, ya que corresponde a bytes que todavía
+ * no se habían retirado de la cola al guardar el archivo.
+ *
+ * @param decoder Estado del decodificador, con los bytes del registro.
+ * @param callback Función invocada por cada registro con valor posterior a una sincronización.
+ * @param context Puntero que se pasa a la función en cada invocación.
+ * @return bool true si el registro es válido, false si contiene un tipo de registro desconocido.
+ */
+static bool decode(decoder_t * decoder, record_cb_t callback, void * context) {
+    uint32_t delta;
+    uint32_t value;
+
+    decoder->offset = 0;
+    decoder->synced = false;
+    decoder->ticks = 0;
+    while (decoder->offset < decoder->size) {
+        uint8_t header = decoder->data[decoder->offset++];
+        uint8_t kind = GPIO_TRACE_KIND(header);
+        uint8_t port = GPIO_TRACE_PORT(header);
+
+        if (kind == GPIO_TRACE_SYNC) {
+            if (!readVarint(decoder, &decoder->frequency)) {
+                break;
+            }
+            memset(decoder->last, 0, sizeof(decoder->last));
+            decoder->absolute = true;
+            continue;
+        }
+        if (kind >= GPIO_TRACE_KINDS) {
+            fprintf(stderr, "Tipo de registro desconocido en la posición %zu\n",
+                    decoder->offset - 1);
+            return false;
+        }
+        if (!readVarint(decoder, &delta) || !readVarint(decoder, &value)) {
+            break;
+        }
+        if (decoder->absolute) {
+            /* El tiempo absoluto continúa la escala anterior, la pausa perdida se desconoce */
+            if (decoder->synced) {
+                decoder->ticks += (uint32_t)(delta - decoder->stamp);
+            }
+            decoder->stamp = delta;
+            decoder->absolute = false;
+            decoder->synced = true;
+        } else if (decoder->synced) {
+            decoder->stamp += delta;
+            decoder->ticks += delta;
+        } else {
+            continue; /**< Registro previo a la primera sincronización. */
+        }
+        decoder->last[kind][port] ^= value;
+        callback(decoder, kind, port, decoder->last[kind][port], context);
+    }
+    return true;
+}
+
+/**
+ * @brief Marca el puerto de un registro como utilizado.
+ *
+ * @param decoder Estado del decodificador.
+ * @param kind Tipo de registro.
+ * @param port Número de puerto.
+ * @param value No se utiliza.
+ * @param context No se utiliza.
+ */
+static void collectPort(decoder_t * decoder, uint8_t kind, uint8_t port, uint32_t value,
+                        void * context) {
+    (void)value;
+    (void)context;
+    decoder->used[kind] |= (uint32_t)1 << port;
+}
+
+/**
+ * @brief Escribe un registro como un cambio de valor en el archivo VCD.
+ *
+ * El instante se convierte a nanosegundos con la frecuencia de la última sincronización y solo se
+ * escribe cuando difiere del anterior. Los segundos completos y el resto se convierten por
+ * separado para que el producto no desborde en registros largos.
+ *
+ * @param decoder Estado del decodificador.
+ * @param kind Tipo de registro.
+ * @param port Número de puerto.
+ * @param value Estado de los pines del puerto.
+ * @param context Archivo de salida.
+ */
+static void writeChange(decoder_t * decoder, uint8_t kind, uint8_t port, uint32_t value,
+                        void * context) {
+    FILE * output = context;
+    uint32_t mask = (uint32_t)1 << port;
+    uint64_t time = decoder->ticks / decoder->frequency * 1000000000u +
+                    decoder->ticks % decoder->frequency * 1000000000u / decoder->frequency;
+
+    if ((valid[kind] & mask) && written[kind][port] == value) {
+        return; /**< La señal no cambia. */
+    }
+    if (time != written_time) {
+        fprintf(output, "#%llu\n", (unsigned long long)time);
+        written_time = time;
+    }
+    fputc('b', output);
+    for (int bit = 31; bit >= 0; bit--) {
+        fputc((value >> bit) & 1 ? '1' : '0', output);
+    }
+    fprintf(output, " %c%c\n", '!' + kind, '!' + port);
+    written[kind][port] = value;
+    valid[kind] |= mask;
+}
+
+/* === Public function implementation ========================================================== */
+
+int main(int argc, char * argv[]) {
+    static uint8_t data[16 * 1024 * 1024];
+    static decoder_t decoder;
+    FILE * input;
+    FILE * output = stdout;
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Uso: %s entrada [salida]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    input = fopen(argv[1], "rb");
+    if (input == NULL) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    decoder.data = data;
+    decoder.size = fread(data, 1, sizeof(data), input);
+    fclose(input);
+
+    if (!decode(&decoder, collectPort, NULL)) {
+        return EXIT_FAILURE;
+    }
+    if (decoder.frequency == 0) {
+        fprintf(stderr, "El registro no contiene una sincronización\n");
+        return EXIT_FAILURE;
+    }
+    if (argc == 3) {
+        output = fopen(argv[2], "w");
+        if (output == NULL) {
+            perror(argv[2]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf(output, "$timescale 1 ns $end\n$scope module gpio $end\n");
+    for (uint8_t kind = 0; kind < GPIO_TRACE_KINDS; kind++) {
+        for (uint8_t port = 0; port < TRACE_PORTS; port++) {
+            if (decoder.used[kind] & ((uint32_t)1 << port)) {
+                fprintf(output, "$var wire 32 %c%c port%u_%s $end\n", '!' + kind, '!' + port,
+                        port, kind_names[kind]);
+            }
+        }
+    }
+    fprintf(output, "$upscope $end\n$enddefinitions $end\n");
+    decode(&decoder, writeChange, output);
+
+    if (output != stdout) {
+        fclose(output);
+    }
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ==================================================================== */